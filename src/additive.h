@@ -0,0 +1,229 @@
+#ifndef ADDITIVE_H
+#define ADDITIVE_H
+
+#include "pin.h"
+#include "params.h"
+#include "profile.h"
+#include "bend.h"
+
+// -------------------- Additive Engine --------------------
+// Single-cycle tables are summed at runtime from 16-partial amplitude lists,
+// one table per (timbre, octave) with only the partials that stay below
+// Nyquist for the highest note of that octave. Tables live in a small cache
+// with LRU eviction and are built by a low-priority task; the audio task
+// never waits, it plays the nearest ready table (or the sine) until the one
+// it asked for is published.
+const int ADD_PARTIALS = 16;
+const int ADD_TIMBRES = 5;
+const int ADD_OCTAVES = 8;
+const int ADD_CACHE_SLOTS = 8;
+const int ADD_TABLE_SIZE = 256;            // Same length and indexing as sineTable
+const int ADD_RETRY_LIMIT = 6;             // Busy-cache retries before requests are dropped
+const TickType_t ADD_RETRY_TICKS = 2;      // First back-off, doubled on each retry
+
+const char* const additiveTimbreNames[ADD_TIMBRES] = {"Organ", "Saw", "Square", "Hollow", "Bright"};
+
+const float additiveTimbres[ADD_TIMBRES][ADD_PARTIALS] = {
+    {1.0f, 0.7f, 0.0f, 0.5f, 0.0f, 0.3f, 0.0f, 0.35f, 0.0f, 0.0f, 0.0f, 0.2f, 0.0f, 0.0f, 0.0f, 0.15f},
+    {1.0f, 0.5f, 0.333f, 0.25f, 0.2f, 0.167f, 0.143f, 0.125f, 0.111f, 0.1f, 0.091f, 0.083f, 0.077f, 0.071f, 0.067f, 0.063f},
+    {1.0f, 0.0f, 0.333f, 0.0f, 0.2f, 0.0f, 0.143f, 0.0f, 0.111f, 0.0f, 0.091f, 0.0f, 0.077f, 0.0f, 0.067f, 0.0f},
+    {1.0f, 0.05f, 0.2f, 0.03f, 0.08f, 0.0f, 0.04f, 0.0f, 0.025f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+    {0.6f, 0.8f, 0.7f, 0.6f, 0.55f, 0.5f, 0.45f, 0.4f, 0.38f, 0.35f, 0.32f, 0.3f, 0.28f, 0.26f, 0.24f, 0.22f}
+};
+
+enum AdditiveSlotState : uint32_t { ADD_SLOT_EMPTY, ADD_SLOT_BUILDING, ADD_SLOT_READY };
+
+struct AdditiveSlot {
+    uint32_t state = ADD_SLOT_EMPTY;
+    int key = -1;                      // timbre * ADD_OCTAVES + octave
+    uint32_t lastUsed = 0;             // Audio block that last played it
+    float table[ADD_TABLE_SIZE];
+};
+
+AdditiveSlot additiveCache[ADD_CACHE_SLOTS];
+uint8_t additiveRequested[ADD_TIMBRES * ADD_OCTAVES];
+uint32_t additiveBlock = 2;            // Audio block counter, starts past the eviction guard
+uint32_t additiveDropped = 0;          // Requests given up on a busy cache
+int additiveTimbre = 0;
+
+// Highest partial that stays below Nyquist for every note of the octave. The
+// table voices step by the fractional part of notePhases, so take the largest.
+int additivePartialLimit(int octave) {
+    float cycles = 0.0f;
+    for (int i = octave * 12; i < octave * 12 + 12; i++) {
+        cycles = std::max(cycles, notePhases[i] - (int)notePhases[i]);
+    }
+    int limit = (cycles > 0.0f) ? (int)(0.5f / cycles) : ADD_PARTIALS;
+    return constrain(limit, 1, ADD_PARTIALS);
+}
+
+// sineTable holds one cycle, so partial k at index i is sineTable[k * i mod 256]
+void additiveBuild(float* table, int timbre, int octave) {
+    int partials = additivePartialLimit(octave);
+    float peak = 0.0f;
+    for (int i = 0; i < ADD_TABLE_SIZE; i++) {
+        float sum = 0.0f;
+        for (int k = 1; k <= partials; k++) {
+            sum += additiveTimbres[timbre][k - 1] * sineTable[(k * i) & (ADD_TABLE_SIZE - 1)];
+        }
+        table[i] = sum;
+        peak = std::max(peak, fabsf(sum));
+    }
+    float scale = (peak > 0.0f) ? 1.0f / peak : 0.0f;
+    for (int i = 0; i < ADD_TABLE_SIZE; i++) table[i] *= scale;
+}
+
+// Audio side: a ready table for key, or null. Marks it used before checking
+// the state so the builder cannot evict it under us (see additiveClaim).
+float* additiveFind(int key) {
+    for (int s = 0; s < ADD_CACHE_SLOTS; s++) {
+        AdditiveSlot& slot = additiveCache[s];
+        if (slot.key != key) continue;
+        __atomic_store_n(&slot.lastUsed, additiveBlock, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&slot.state, __ATOMIC_SEQ_CST) == ADD_SLOT_READY && slot.key == key) {
+            return slot.table;
+        }
+    }
+    return nullptr;
+}
+
+// Table to play for an octave this block, asking for it if it isn't cached.
+// Falls back to the nearest higher octave (fewer partials, still alias free),
+// then to any ready octave of the timbre, then to the sine.
+const float* additiveTableFor(int octave) {
+    int base = additiveTimbre * ADD_OCTAVES;
+    float* table = additiveFind(base + octave);
+    if (table) return table;
+
+    if (!__atomic_load_n(&additiveRequested[base + octave], __ATOMIC_RELAXED)) {
+        __atomic_store_n(&additiveRequested[base + octave], 1, __ATOMIC_RELEASE);
+        if (additiveGen_Handle) xTaskNotifyGive(additiveGen_Handle);
+    }
+    for (int o = octave + 1; o < ADD_OCTAVES; o++) {
+        if ((table = additiveFind(base + o))) return table;
+    }
+    for (int o = octave - 1; o >= 0; o--) {
+        if ((table = additiveFind(base + o))) return table;
+    }
+    return sineTable;
+}
+
+// Builder side: take a slot to overwrite, preferring empty ones, then the
+// least recently used one that hasn't played in the last two blocks.
+int additiveClaim() {
+    for (int attempt = 0; attempt < ADD_CACHE_SLOTS; attempt++) {
+        uint32_t now = __atomic_load_n(&additiveBlock, __ATOMIC_SEQ_CST);
+        int victim = -1;
+        uint32_t victimAge = 0;
+        for (int s = 0; s < ADD_CACHE_SLOTS; s++) {
+            AdditiveSlot& slot = additiveCache[s];
+            uint32_t state = __atomic_load_n(&slot.state, __ATOMIC_SEQ_CST);
+            if (state == ADD_SLOT_EMPTY) return s;
+            uint32_t age = now - __atomic_load_n(&slot.lastUsed, __ATOMIC_RELAXED);
+            if (state != ADD_SLOT_READY || age < 2) continue;
+            if (victim < 0 || age > victimAge) {
+                victim = s;
+                victimAge = age;
+            }
+        }
+        if (victim < 0) return -1;
+
+        AdditiveSlot& slot = additiveCache[victim];
+        uint32_t expected = ADD_SLOT_READY;
+        if (!__atomic_compare_exchange_n(&slot.state, &expected, ADD_SLOT_BUILDING, false,
+                                         __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) continue;
+        // The audio task may have picked it up between the scan and the swap
+        uint32_t used = __atomic_load_n(&slot.lastUsed, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&additiveBlock, __ATOMIC_SEQ_CST) - used < 2) {
+            __atomic_store_n(&slot.state, ADD_SLOT_READY, __ATOMIC_SEQ_CST);
+            continue;
+        }
+        return victim;
+    }
+    return -1;
+}
+
+// Build one requested table; returns false when nothing could be done
+bool additiveServiceOne() {
+    for (int key = 0; key < ADD_TIMBRES * ADD_OCTAVES; key++) {
+        if (!__atomic_load_n(&additiveRequested[key], __ATOMIC_ACQUIRE)) continue;
+
+        int s = additiveClaim();
+        if (s < 0) return false;
+        AdditiveSlot& slot = additiveCache[s];
+        __atomic_store_n(&slot.state, ADD_SLOT_BUILDING, __ATOMIC_SEQ_CST);
+        slot.key = key;
+        additiveBuild(slot.table, key / ADD_OCTAVES, key % ADD_OCTAVES);
+        __atomic_store_n(&slot.state, ADD_SLOT_READY, __ATOMIC_RELEASE);
+        __atomic_store_n(&additiveRequested[key], 0, __ATOMIC_RELEASE);
+        return true;
+    }
+    return false;
+}
+
+bool additivePending() {
+    for (int key = 0; key < ADD_TIMBRES * ADD_OCTAVES; key++) {
+        if (__atomic_load_n(&additiveRequested[key], __ATOMIC_RELAXED)) return true;
+    }
+    return false;
+}
+
+// Clears what is still requested. The audio task keeps playing its fallback
+// and asks again on the next block that needs the table.
+void additiveDropRequests() {
+    for (int key = 0; key < ADD_TIMBRES * ADD_OCTAVES; key++) {
+        if (__atomic_exchange_n(&additiveRequested[key], 0, __ATOMIC_ACQ_REL)) additiveDropped++;
+    }
+}
+
+// Lowest-priority task: sleeps until the audio task asks for a table. While
+// every slot is busy it backs off (2, 4 ... 64 ticks), then drops the rest.
+void additiveTask(void* pvParameters) {
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        TickType_t backoff = ADD_RETRY_TICKS;
+        for (int retry = 0; ; retry++) {
+            profileBegin(PROF_ADDITIVE);
+            while (additiveServiceOne()) {}
+            profileEnd(PROF_ADDITIVE);
+            if (!additivePending()) break;
+            if (retry == ADD_RETRY_LIMIT) {
+                additiveDropRequests();
+                break;
+            }
+            vTaskDelay(backoff);
+            backoff *= 2;
+        }
+    }
+}
+
+// Render every held note into block (8-bit units, averaged over notes like
+// mixActiveNotes). Returns the held count.
+int additiveRenderBlock(float* block, int length, int volume) {
+    if (paramChanged(PARAM_ADDITIVE)) additiveTimbre = constrain(backendSettings.additive.timbre, 0, ADD_TIMBRES - 1);
+    __atomic_add_fetch(&additiveBlock, 1, __ATOMIC_SEQ_CST);
+
+    memset(block, 0, length * sizeof(float));
+    const float* octaveTables[ADD_OCTAVES] = {nullptr};
+    int held = 0;
+    for (int i = 0; i < 96; ++i) {
+        if (!__atomic_load_n(&notes.notes[i].active, __ATOMIC_RELAXED)) continue;
+        held++;
+        int octave = i / 12;
+        if (!octaveTables[octave]) octaveTables[octave] = additiveTableFor(octave);
+        const float* table = octaveTables[octave];
+
+        for (int n = 0; n < length; n++) {
+            float amp = getSample(bentPhases[i], &notes.notes[i].floatPhaseAcc, (float*)table);
+            block[n] += addEffects(amp, volume, i);
+        }
+    }
+
+    if (held > 0) {
+        const float noteScale = 1.0f / held;
+        for (int n = 0; n < length; n++) block[n] *= noteScale;
+    }
+    return held;
+}
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef ADPCM_H
+#define ADPCM_H
+
+#include <stdint.h>
+
+// -------------------- IMA-ADPCM Codec --------------------
+// Plain C so the host converter in tools/wav2adpcm.cpp encodes against the
+// exact decoder the firmware runs.
+const int16_t adpcmStepTable[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+
+const int8_t adpcmIndexTable[16] = {-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+
+struct AdpcmDecoder {
+    int32_t predictor;
+    int32_t index;
+    uint32_t position;          // Next sample to decode
+};
+
+inline int16_t adpcmDecodeNibble(AdpcmDecoder& dec, uint8_t nibble) {
+    int32_t step = adpcmStepTable[dec.index];
+    int32_t diff = step >> 3;
+    if (nibble & 4) diff += step;
+    if (nibble & 2) diff += step >> 1;
+    if (nibble & 1) diff += step >> 2;
+    dec.predictor += (nibble & 8) ? -diff : diff;
+    if (dec.predictor > INT16_MAX) dec.predictor = INT16_MAX;
+    if (dec.predictor < INT16_MIN) dec.predictor = INT16_MIN;
+    dec.index += adpcmIndexTable[nibble];
+    if (dec.index < 0) dec.index = 0;
+    if (dec.index > 88) dec.index = 88;
+    return (int16_t)dec.predictor;
+}
+
+// Pick the nibble closest to target and advance the decoder with it
+inline uint8_t adpcmEncodeSample(AdpcmDecoder& dec, int16_t target) {
+    int32_t diff = target - dec.predictor;
+    int32_t step = adpcmStepTable[dec.index];
+    uint8_t nibble = 0;
+    if (diff < 0) { nibble = 8; diff = -diff; }
+    if (diff >= step) { nibble |= 4; diff -= step; }
+    step >>= 1;
+    if (diff >= step) { nibble |= 2; diff -= step; }
+    step >>= 1;
+    if (diff >= step) nibble |= 1;
+    adpcmDecodeNibble(dec, nibble);
+    return nibble;
+}
+
+#endif
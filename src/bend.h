@@ -0,0 +1,102 @@
+#ifndef BEND_H
+#define BEND_H
+
+#include "pin.h"
+#include "params.h"
+
+// -------------------- Pitch Bend and Vibrato --------------------
+// The joystick X axis bends every voice by up to +/- the configured range and
+// the Y axis sets the vibrato depth. The joystick task only publishes the two
+// positions; the audio task ramps towards them across each half buffer, turns
+// the result into a frequency ratio once per 64-sample block through an
+// exponential table, and rescales the per-note phase increments with it.
+// Engines read bentPhases / bentPhaseIncs instead of the raw note tables.
+const int BEND_INPUT_SCALE = 1024;          // Full deflection
+const int BEND_LUT_SEGMENTS = 64;           // Across -1..+1 octave, about 0.1 cent worst case
+const float BEND_VIBRATO_CENTS_PER_STEP = 10.0f;
+const float BEND_VIBRATO_HZ_PER_STEP = 0.8f;
+
+// Written by scanJoystickTask, read by the audio task once per half buffer
+int32_t joystickBend = 0;                   // -BEND_INPUT_SCALE..BEND_INPUT_SCALE
+int32_t joystickVibrato = 0;                // 0..BEND_INPUT_SCALE
+
+float bendExpTable[BEND_LUT_SEGMENTS + 1];  // 2^x for x in [-1, 1]
+float bentPhases[96];
+uint32_t bentPhaseIncs[96];
+float pitchBendRatio = 0.0f;                // Ratio bentPhases were built with
+uint32_t pitchTableVersion = 0;             // Bumped whenever bentPhases change
+
+struct {
+    SmoothedParam bend;                     // -1..1
+    SmoothedParam vibrato;                  // 0..1
+    float range = 2.0f;                     // Semitones at full bend
+    float depth = 0.5f;                     // Semitones at full vibrato
+    uint32_t lfoPhase = 0;
+    uint32_t lfoInc = 0;
+} bendState;
+
+// 2^(semitones / 12) by linear interpolation, clamped to one octave either way
+inline float bendRatio(float semitones) {
+    float pos = (constrain(semitones / 12.0f, -1.0f, 1.0f) + 1.0f) * (BEND_LUT_SEGMENTS / 2);
+    int i = std::min((int)pos, BEND_LUT_SEGMENTS - 1);
+    float frac = pos - i;
+    return bendExpTable[i] + (bendExpTable[i + 1] - bendExpTable[i]) * frac;
+}
+
+// Rebuild the per-note increments; only the fractional cycle of notePhases
+// sounds, so bend that and keep the accumulators bounded
+void bendApplyRatio(float ratio) {
+    pitchBendRatio = ratio;
+    for (int i = 0; i < 96; i++) {
+        bentPhaseIncs[i] = (uint32_t)(int64_t)(notePhaseIncs[i] * ratio);
+        bentPhases[i] = bentPhaseIncs[i] * (1.0f / 4294967296.0f);
+    }
+    pitchTableVersion++;
+}
+
+// After generatePhaseLUT()
+void bendInit() {
+    for (int i = 0; i <= BEND_LUT_SEGMENTS; i++) {
+        bendExpTable[i] = powf(2.0f, 2.0f * i / BEND_LUT_SEGMENTS - 1.0f);
+    }
+    bendApplyRatio(1.0f);
+}
+
+// Joystick side; bend and vibrato in units of BEND_INPUT_SCALE
+void bendSetInputs(int32_t bend, int32_t vibrato) {
+    __atomic_store_n(&joystickBend, bend, __ATOMIC_RELAXED);
+    __atomic_store_n(&joystickVibrato, vibrato, __ATOMIC_RELAXED);
+}
+
+// Control rate: ramp towards the latest joystick position over `length` samples
+void updateBendParams(int length) {
+    if (paramChanged(PARAM_BEND)) {
+        bendState.range = backendSettings.bend.range;
+        bendState.depth = backendSettings.bend.depth * BEND_VIBRATO_CENTS_PER_STEP / 100.0f;
+        bendState.lfoInc = (uint32_t)(backendSettings.bend.rate * BEND_VIBRATO_HZ_PER_STEP * 4294967296.0f / SAMPLE_RATE);
+    }
+    bendState.bend.setTarget((float)__atomic_load_n(&joystickBend, __ATOMIC_RELAXED) / BEND_INPUT_SCALE, length);
+    bendState.vibrato.setTarget((float)__atomic_load_n(&joystickVibrato, __ATOMIC_RELAXED) / BEND_INPUT_SCALE, length);
+}
+
+// Block rate, with `offset` semitones from the mod matrix: returns true if
+// the increments changed this block
+bool pitchBendBlock(int length, float offset) {
+    bendState.bend.current += bendState.bend.step * length;
+    bendState.vibrato.current += bendState.vibrato.step * length;
+
+    float semitones = bendState.bend.current * bendState.range + offset;
+    if (bendState.vibrato.current > 0.0f) {
+        semitones += bendState.vibrato.current * bendState.depth * sineTable[bendState.lfoPhase >> 24];
+        bendState.lfoPhase += bendState.lfoInc * length;
+    } else {
+        bendState.lfoPhase = 0;
+    }
+
+    float ratio = bendRatio(semitones);
+    if (ratio == pitchBendRatio) return false;
+    bendApplyRatio(ratio);
+    return true;
+}
+
+#endif
@@ -0,0 +1,199 @@
+#ifndef DRUMKIT_H
+#define DRUMKIT_H
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+// -------------------- Drum Kit Synthesis --------------------
+// The pads of src/drums.h without triggering or mixing: a pitch-swept sine
+// kick, a snare (short tone plus band-passed noise), a clap (noise bursts
+// through a band-pass) and closed/open hats (high-passed noise). One block of
+// xorshift noise is shared by all noise pads, envelopes move once per block
+// and are ramped linearly inside it, and the filters are float state-variable
+// or one-pole sections. Plain C++ so tools/drumbench.cpp times the same code.
+#ifndef SAMPLE_RATE
+#define SAMPLE_RATE 22000                       // As in pin.h, for host builds
+#endif
+
+extern float sineTable[256];
+
+enum DrumPad { DRUM_KICK, DRUM_SNARE, DRUM_CLAP, DRUM_CLOSED_HAT, DRUM_OPEN_HAT, DRUM_PADS };
+
+const int DRUM_BLOCK_SIZE = 64;
+
+struct DrumEnv {
+    float level = 0.0f;
+    float rate = 0.0f;           // Log decay per sample
+    float step = 0.0f;           // Per-sample ramp for the current block
+};
+
+struct Svf {
+    float low = 0.0f, band = 0.0f;
+    float f, q;                  // Chamberlin coefficients
+};
+
+struct {
+    DrumEnv env[DRUM_PADS];
+    DrumEnv kickPitch;
+    uint32_t kickPhase = 0;
+    uint32_t snarePhase = 0;
+    int clapCount = 0;           // Samples since the clap fired
+    Svf snareFilter, clapFilter;
+    float hatLow = 0.0f;
+    uint32_t rng = 0x6C078965;
+    float noise[DRUM_BLOCK_SIZE];
+    float out[DRUM_BLOCK_SIZE];
+    float level[DRUM_BLOCK_SIZE];   // Sum of the pad envelopes, bounds |out|
+} drumState;
+
+const float DRUM_DECAY_TIMES[DRUM_PADS] = {0.35f, 0.18f, 0.25f, 0.05f, 0.4f};
+const float DRUM_KICK_START = 160.0f;       // Hz, swept down to DRUM_KICK_END
+const float DRUM_KICK_END = 45.0f;
+const float DRUM_KICK_SWEEP_TIME = 0.04f;
+const float DRUM_SNARE_TONE = 185.0f;
+const float DRUM_CLAP_SPACING = 0.011f;     // Seconds between the first three bursts
+const float DRUM_HAT_POLE = 0.55f;          // One-pole low-pass removed from the noise
+
+inline float drumDecayRate(float seconds) {
+    return -6.9f / (seconds * SAMPLE_RATE);   // -60 dB after `seconds`
+}
+
+void drumSvfInit(Svf& svf, float freq, float q) {
+    svf.f = 2.0f * sinf((float)M_PI * freq / SAMPLE_RATE);
+    svf.q = 1.0f / q;
+}
+
+void drumsInit() {
+    for (int p = 0; p < DRUM_PADS; p++) drumState.env[p].rate = drumDecayRate(DRUM_DECAY_TIMES[p]);
+    drumState.kickPitch.rate = drumDecayRate(DRUM_KICK_SWEEP_TIME);
+    drumSvfInit(drumState.snareFilter, 1800.0f, 0.8f);
+    drumSvfInit(drumState.clapFilter, 1200.0f, 1.5f);
+}
+
+void drumStart(int pad) {
+    drumState.env[pad].level = 1.0f;
+    switch (pad) {
+        case DRUM_KICK:
+            drumState.kickPitch.level = 1.0f;
+            drumState.kickPhase = 0;
+            break;
+        case DRUM_CLAP:
+            drumState.clapCount = 0;
+            break;
+        case DRUM_CLOSED_HAT:
+            drumState.env[DRUM_OPEN_HAT].level = 0.0f;   // Closing chokes the open hat
+            break;
+        default:
+            break;
+    }
+}
+
+// Next block value of an envelope and its per-sample ramp towards it
+inline float drumEnvBlock(DrumEnv& env, int length) {
+    float start = env.level;
+    env.level *= expf(env.rate * length);
+    if (env.level < 1e-4f) env.level = 0.0f;
+    env.step = (env.level - start) / length;
+    return start;
+}
+
+inline float svfBandPass(Svf& svf, float x) {
+    svf.low += svf.f * svf.band;
+    float high = x - svf.low - svf.q * svf.band;
+    svf.band += svf.f * high;
+    return svf.band;
+}
+
+// Clap amplitude: three short bursts, then the tail follows the pad envelope
+inline float drumClapShape(int count) {
+    int spacing = (int)(DRUM_CLAP_SPACING * SAMPLE_RATE);
+    if (count >= 3 * spacing) return 1.0f;
+    return 1.0f - (float)(count % spacing) / spacing;
+}
+
+bool drumsActive() {
+    for (int p = 0; p < DRUM_PADS; p++) {
+        if (drumState.env[p].level > 0.0f) return true;
+    }
+    return false;
+}
+
+// Render the sounding pads into drumState.out (bipolar) and drumState.level
+// for one block of at most DRUM_BLOCK_SIZE samples. Returns false when all
+// are silent.
+bool drumRenderPads(int length) {
+    float* out = drumState.out;
+    float* level = drumState.level;
+    if (!drumsActive()) return false;
+    memset(out, 0, length * sizeof(float));
+    memset(level, 0, length * sizeof(float));
+
+    // Shared white noise in [-1, 1)
+    uint32_t x = drumState.rng;
+    for (int n = 0; n < length; n++) {
+        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+        drumState.noise[n] = (int32_t)x * (1.0f / 2147483648.0f);
+    }
+    drumState.rng = x;
+
+    // Kick: sine swept from DRUM_KICK_START down to DRUM_KICK_END
+    if (drumState.env[DRUM_KICK].level > 0.0f) {
+        float amp = drumEnvBlock(drumState.env[DRUM_KICK], length);
+        float sweep = drumEnvBlock(drumState.kickPitch, length);
+        const float hzToInc = 4294967296.0f / SAMPLE_RATE;
+        float inc = (DRUM_KICK_END + (DRUM_KICK_START - DRUM_KICK_END) * sweep) * hzToInc;
+        float incStep = (DRUM_KICK_START - DRUM_KICK_END) * drumState.kickPitch.step * hzToInc;
+        for (int n = 0; n < length; n++) {
+            out[n] += sineTable[drumState.kickPhase >> 24] * amp;
+            level[n] += amp;
+            drumState.kickPhase += (uint32_t)inc;
+            inc += incStep;
+            amp += drumState.env[DRUM_KICK].step;
+        }
+    }
+
+    // Snare: fixed tone plus band-passed noise
+    if (drumState.env[DRUM_SNARE].level > 0.0f) {
+        float amp = drumEnvBlock(drumState.env[DRUM_SNARE], length);
+        const uint32_t toneInc = (uint32_t)(DRUM_SNARE_TONE * 4294967296.0f / SAMPLE_RATE);
+        for (int n = 0; n < length; n++) {
+            float noise = svfBandPass(drumState.snareFilter, drumState.noise[n]);
+            float tone = sineTable[drumState.snarePhase >> 24];
+            drumState.snarePhase += toneInc;
+            out[n] += (0.6f * noise + 0.4f * tone) * amp;
+            level[n] += amp;
+            amp += drumState.env[DRUM_SNARE].step;
+        }
+    }
+
+    // Clap: band-passed noise in bursts
+    if (drumState.env[DRUM_CLAP].level > 0.0f) {
+        float amp = drumEnvBlock(drumState.env[DRUM_CLAP], length);
+        for (int n = 0; n < length; n++) {
+            float noise = svfBandPass(drumState.clapFilter, drumState.noise[n]);
+            out[n] += noise * drumClapShape(drumState.clapCount++) * amp;
+            level[n] += amp;
+            amp += drumState.env[DRUM_CLAP].step;
+        }
+    }
+
+    // Hats: one high-passed noise stream, shaped by the sum of both envelopes
+    if (drumState.env[DRUM_CLOSED_HAT].level > 0.0f || drumState.env[DRUM_OPEN_HAT].level > 0.0f) {
+        float closed = drumEnvBlock(drumState.env[DRUM_CLOSED_HAT], length);
+        float open = drumEnvBlock(drumState.env[DRUM_OPEN_HAT], length);
+        float amp = 0.5f * (closed + open);
+        float ampStep = 0.5f * (drumState.env[DRUM_CLOSED_HAT].step + drumState.env[DRUM_OPEN_HAT].step);
+        float low = drumState.hatLow;
+        for (int n = 0; n < length; n++) {
+            low += DRUM_HAT_POLE * (drumState.noise[n] - low);
+            out[n] += (drumState.noise[n] - low) * amp;
+            level[n] += amp;
+            amp += ampStep;
+        }
+        drumState.hatLow = low;
+    }
+    return true;
+}
+
+#endif
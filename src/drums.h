@@ -0,0 +1,101 @@
+#ifndef DRUMS_H
+#define DRUMS_H
+
+#include "pin.h"
+#include "params.h"
+#include "effect.h"
+#include "drumkit.h"
+
+// -------------------- Drum Voice Engine --------------------
+// Five one-shot pads (src/drumkit.h) layered over the keyboard voice. Pads
+// fire from the keys of the designated board or from a 16-step pattern
+// clocked at sixteenths of the metronome beat.
+
+// Keys C, D, E, F, G of the drum board; other keys are unused
+const int8_t drumKeyMap[12] = {
+    DRUM_KICK, -1, DRUM_SNARE, -1, DRUM_CLAP, DRUM_CLOSED_HAT, -1, DRUM_OPEN_HAT, -1, -1, -1, -1
+};
+
+// Bit per pad for each of the 16 steps; pattern 0 is "off"
+const int DRUM_PATTERNS = 4;
+const int DRUM_STEPS = 16;
+#define K (1 << DRUM_KICK)
+#define S (1 << DRUM_SNARE)
+#define C (1 << DRUM_CLAP)
+#define H (1 << DRUM_CLOSED_HAT)
+#define O (1 << DRUM_OPEN_HAT)
+const uint8_t drumPatterns[DRUM_PATTERNS][DRUM_STEPS] = {
+    {0},
+    {K|H, 0, H, 0, S|H, 0, H, 0, K|H, 0, K|H, 0, S|H, 0, H, 0},      // Rock
+    {K, 0, O, 0, K|C, 0, O, 0, K, 0, O, 0, K|C, 0, O, H},             // Four on the floor
+    {K|H, 0, H, K, S|H, 0, H, S, 0, K, H, 0, S|H, 0, C, H}            // Break
+};
+#undef K
+#undef S
+#undef C
+#undef H
+#undef O
+
+struct {
+    int stepLength = 0;          // Samples per sixteenth
+    int stepCounter = 0;
+    int step = 0;
+} drumPattern;
+
+// Pads fired by decodeTask; taken by the audio task once per block
+uint32_t drumTriggers = 0;
+
+// Safe from any task; the pad starts at the next block
+void drumTrigger(int pad) {
+    if (pad >= 0 && pad < DRUM_PADS) __atomic_fetch_or(&drumTriggers, 1u << pad, __ATOMIC_RELAXED);
+}
+
+// Pattern clock; called once per block
+void drumPatternBlock(int length) {
+    int pattern = constrain(backendSettings.drums.pattern, 0, DRUM_PATTERNS - 1);
+    if (pattern == 0) {
+        drumPattern.step = 0;
+        drumPattern.stepCounter = 0;
+        return;
+    }
+    drumPattern.stepLength = delayTimeSamples(backendSettings.metronome.speed, 1);
+    drumPattern.stepCounter -= length;
+    if (drumPattern.stepCounter > 0) return;
+
+    drumPattern.stepCounter += drumPattern.stepLength;
+    uint8_t pads = drumPatterns[pattern][drumPattern.step];
+    for (int p = 0; p < DRUM_PADS; p++) {
+        if (pads >> p & 1) drumStart(p);
+    }
+    drumPattern.step = (drumPattern.step + 1) % DRUM_STEPS;
+}
+
+// Render the kit into drumState.out (bipolar) and drumState.level for one
+// block of at most DRUM_BLOCK_SIZE samples. Returns false when all is silent.
+bool drumRenderBlock(int length) {
+    uint32_t fired = __atomic_exchange_n(&drumTriggers, 0, __ATOMIC_RELAXED);
+    for (int p = 0; p < DRUM_PADS; p++) {
+        if (fired >> p & 1) drumStart(p);
+    }
+    drumPatternBlock(length);
+    return drumRenderPads(length);
+}
+
+// Mix the kit into the voice block (8-bit units). The keyboard voice is
+// ducked only while pads sound, by up to half following the kit's envelope:
+// at full kit level the two share the output equally, and the voice returns
+// as the pads decay. Like the other engines the kit is offset by its own
+// envelope, so it decays to zero.
+bool addDrums(float* block, int length, int volume) {
+    if (!backendSettings.drums.on || !drumRenderBlock(length)) return false;
+
+    float gain = ldexpf(127.5f, volume - 8);
+    for (int n = 0; n < length; n++) {
+        float level = std::min(drumState.level[n], 1.0f);
+        float drum = constrain(drumState.out[n], -level, level);
+        block[n] = block[n] * (1.0f - 0.5f * level) + (drum + level) * 0.5f * gain;
+    }
+    return true;
+}
+
+#endif
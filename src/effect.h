@@ -2,7 +2,10 @@
 #define EFFECT_H
 
 #include "pin.h"
+#include "params.h"
 #include <Arduino.h>
+#include <STM32FreeRTOS.h>
+#include <stdlib.h>
 
 //------------------------------------------------------------------------------
 // External Settings Declaration
@@ -24,6 +27,99 @@ const int CHORUS_BUFFER_SIZE = 512;
 float chorusBuffer[CHORUS_BUFFER_SIZE] = {0};
 int chorusIndex = 0;
 
+// Delay buffer
+// Echo history is stored as int16_t and allocated from the SRAM that is left
+// once every task exists, optionally at a decimated rate so a full beat still
+// fits.
+const int DELAY_MAX_TIME = metronomeTime[0];     // Longest beat (samples)
+const int DELAY_MAX_DECIMATION = 4;
+const float DELAY_SCALE = 32.0f;                 // Float to int16 storage scale, 4x full scale
+const float DELAY_DAMPING = 0.35f;               // One-pole lowpass in the feedback path
+const float DELAY_DC_BLOCK = 0.005f;             // One-pole highpass in the feedback path
+const float DELAY_WET = 0.5f;
+
+// SRAM kept back from the delay line. vTaskStartScheduler allocates after it:
+// the idle task, and with configUSE_TIMERS the timer task and its command
+// queue, each task a stack plus a TCB. The margin is for newlib's own mallocs
+// after start-up (snprintf, Serial, U8g2). With the stock STM32FreeRTOS
+// config (128-word idle, 256-word timer stack) this comes to 4 KB.
+const size_t DELAY_TCB_BYTES = 128;              // TCB, rounded up
+const size_t DELAY_HEAP_MARGIN = 2 * 1024;
+#if configUSE_TIMERS
+const size_t DELAY_TIMER_TASK_BYTES = configTIMER_TASK_STACK_DEPTH * sizeof(StackType_t) + DELAY_TCB_BYTES +
+                                      configTIMER_QUEUE_LENGTH * 16 + 96;   // 16 B commands, queue header
+#else
+const size_t DELAY_TIMER_TASK_BYTES = 0;
+#endif
+const size_t DELAY_SRAM_RESERVE = configMINIMAL_STACK_SIZE * sizeof(StackType_t) + DELAY_TCB_BYTES +
+                                  DELAY_TIMER_TASK_BYTES + DELAY_HEAP_MARGIN;
+
+int16_t* delayBuffer = nullptr;
+int delayBufferSize = 0;
+int delayIndex = 0;
+int delayDecimation = 1;
+int delayDecimCounter = 0;
+float delayDecimAcc = 0.0f;
+float delayHeld = 0.0f;
+float delayDampState = 0.0f;
+float delayDcState = 0.0f;
+
+//------------------------------------------------------------------------------
+// Delay Buffer Allocation
+//------------------------------------------------------------------------------
+extern "C" char* sbrk(int incr);
+extern "C" char _estack;
+extern "C" char _Min_Stack_Size;
+
+// Bytes between the top of the heap and the reserved main stack
+size_t freeSram() {
+    char* heapTop = sbrk(0);
+    char* stackLimit = &_estack - (size_t)&_Min_Stack_Size;
+    return (stackLimit > heapTop) ? (size_t)(stackLimit - heapTop) : 0;
+}
+
+void resetDelay() {
+    if (delayBuffer != nullptr) memset(delayBuffer, 0, delayBufferSize * sizeof(int16_t));
+    delayIndex = 0;
+    delayDecimCounter = 0;
+    delayDecimAcc = 0.0f;
+    delayHeld = 0.0f;
+    delayDampState = 0.0f;
+    delayDcState = 0.0f;
+}
+
+// In setup, after the last xTaskCreate: the task stacks come from the same heap
+void initDelayBuffer() {
+    if (delayBuffer != nullptr) return;
+
+    size_t freeBytes = freeSram();
+    size_t budget = (freeBytes > DELAY_SRAM_RESERVE) ? (freeBytes - DELAY_SRAM_RESERVE) / sizeof(int16_t) : 0;
+
+    // Decimate until the longest beat fits the budget
+    delayDecimation = 1;
+    while (delayDecimation < DELAY_MAX_DECIMATION &&
+           (size_t)(DELAY_MAX_TIME / delayDecimation + 1) > budget) {
+        delayDecimation *= 2;
+    }
+
+    size_t wanted = DELAY_MAX_TIME / delayDecimation + 1;
+    delayBufferSize = (wanted < budget) ? wanted : budget;
+    if (delayBufferSize < 2) {
+        delayBufferSize = 0;
+        return;
+    }
+    delayBuffer = (int16_t*)malloc(delayBufferSize * sizeof(int16_t));
+    if (delayBuffer == nullptr) delayBufferSize = 0;
+    resetDelay();
+}
+
+// Delay time in samples: one metronome beat scaled by division/4.
+// Speed 8 (metronome off) falls back to the slowest beat.
+int delayTimeSamples(int metronomeSpeed, int division) {
+    int beatIndex = constrain(7 - metronomeSpeed, 0, 6);
+    return metronomeTime[beatIndex] * division / 4;
+}
+
 //------------------------------------------------------------------------------
 // Initialization of Audio Effects Module
 //------------------------------------------------------------------------------
@@ -32,98 +128,220 @@ void initEffects() {
     settings.reverb_on = false;
     settings.distortion_on = false;
     settings.chorus_on = false;
+    settings.delay_on = false;
 
     // Set default strength values
     settings.reverb_strength = 5;
     settings.distortion_strength = 5;
     settings.chorus_strength = 5;
+    settings.delay_strength = 5;
+    settings.delay_division = 4;
 
     // Clear the effect buffers
     memset(reverbBuffer, 0, sizeof(reverbBuffer));
     memset(chorusBuffer, 0, sizeof(chorusBuffer));
     reverbIndex = 0;
     chorusIndex = 0;
+
+    resetDelay();
+
+    invalidateParams();
 }
 
 //------------------------------------------------------------------------------
-// Reverb Effect
+// Stage Parameters
 //------------------------------------------------------------------------------
-float applyReverb(float inputSample) {
-
-    if (!settings.reverb_on) return inputSample;
-
-    float decayFactor = 0.2f + (settings.reverb_strength * 0.06f);
+// Derived from settings at block start and ramped across the block
+SmoothedParam reverbDecay, reverbWet;
+SmoothedParam distortionGain, distortionWet;
+SmoothedParam chorusDepth, chorusWet;
+SmoothedParam delayFeedback, delayWet;
+int delayLength = 1;
 
-    float delayedSample = reverbBuffer[reverbIndex];
+//------------------------------------------------------------------------------
+// Reverb Effect
+//------------------------------------------------------------------------------
+void reverbBlock(float* block, int length) {
+    for (int n = 0; n < length; n++) {
+        float inputSample = block[n];
+        float delayedSample = reverbBuffer[reverbIndex];
+        float wet = reverbWet.next();
 
-    float outputSample = inputSample + delayedSample * decayFactor;
+        float outputSample = inputSample + delayedSample * reverbDecay.next();
 
-    reverbBuffer[reverbIndex] = (reverbBuffer[reverbIndex] * 0.8f) + (outputSample * 0.2f);
+        reverbBuffer[reverbIndex] = (reverbBuffer[reverbIndex] * 0.8f) + (outputSample * 0.2f);
 
-    reverbIndex++;
-    if (reverbIndex >= REVERB_BUFFER_SIZE) reverbIndex = 0;
+        reverbIndex++;
+        if (reverbIndex >= REVERB_BUFFER_SIZE) reverbIndex = 0;
 
-    return (outputSample < -1.0f) ? -1.0f : (outputSample > 1.0f ? 1.0f : outputSample);
+        outputSample = (outputSample < -1.0f) ? -1.0f : (outputSample > 1.0f ? 1.0f : outputSample);
+        block[n] = inputSample + (outputSample - inputSample) * wet;
+    }
 }
 
 //------------------------------------------------------------------------------
 // Distortion Effect
 //------------------------------------------------------------------------------
-float applyDistortion(float inputSample) {
-    if (!settings.distortion_on) return inputSample;
-
-    float gain = 3.0f + (settings.distortion_strength * 0.7f);
-
-    float outputSample = tanh(fmin(fmax(inputSample * gain, -10.0f), 10.0f));
-
-    return outputSample;
+void distortionBlock(float* block, int length) {
+    for (int n = 0; n < length; n++) {
+        float inputSample = block[n];
+        float wet = distortionWet.next();
+        float outputSample = tanh(fmin(fmax(inputSample * distortionGain.next(), -10.0f), 10.0f));
+        block[n] = inputSample + (outputSample - inputSample) * wet;
+    }
 }
 
 
 //------------------------------------------------------------------------------
 // Chorus Effect
 //------------------------------------------------------------------------------
-float applyChorus(float inputSample) {
-
-    if (!settings.chorus_on) return inputSample;
-
+void chorusBlock(float* block, int length) {
     static float chorusPhase = 0.0f;
-    float lfo = sinf(chorusPhase);
-    chorusPhase += 0.01f;
-    if (chorusPhase > 2 * PI) chorusPhase -= 2 * PI;
-    float strengthFactor = settings.chorus_strength / 10.0f;
-    int delaySamples = 5 + strengthFactor * 20;
-    delaySamples += int(lfo * 3.0f);
 
-    int delayedIndex = (chorusIndex - delaySamples + CHORUS_BUFFER_SIZE) % CHORUS_BUFFER_SIZE;
-    float delayedSample = chorusBuffer[delayedIndex];
+    for (int n = 0; n < length; n++) {
+        float inputSample = block[n];
+        float wet = chorusWet.next();
+        float lfo = sinf(chorusPhase);
+        chorusPhase += 0.01f;
+        if (chorusPhase > 2 * PI) chorusPhase -= 2 * PI;
+        int delaySamples = int(chorusDepth.next() + lfo * 3.0f);
 
-    chorusBuffer[chorusIndex] = inputSample;
-    chorusIndex = (chorusIndex + 1) % CHORUS_BUFFER_SIZE;
+        int delayedIndex = (chorusIndex - delaySamples + CHORUS_BUFFER_SIZE) % CHORUS_BUFFER_SIZE;
+        float delayedSample = chorusBuffer[delayedIndex];
 
-    return inputSample * 0.7f + delayedSample * 0.3f;
+        chorusBuffer[chorusIndex] = inputSample;
+        chorusIndex = (chorusIndex + 1) % CHORUS_BUFFER_SIZE;
+
+        float outputSample = inputSample * 0.7f + delayedSample * 0.3f;
+        block[n] = inputSample + (outputSample - inputSample) * wet;
+    }
 }
 
 
 //------------------------------------------------------------------------------
-// Apply All Audio Effects with Dry/Wet Mixing
+// Delay (Echo) Effect
 //------------------------------------------------------------------------------
-float applyEffects(float inputSample) {
-    float wetSignal = 0.0f;
+// The wet path is the echo alone; delayWet sets the echo level.
+void delayBlock(float* block, int length) {
+    for (int n = 0; n < length; n++) {
+        float inputSample = block[n];
+        float wet = delayWet.next();
+        float feedback = delayFeedback.next();
+
+        // Average the input down to the decimated rate
+        delayDecimAcc += inputSample;
+        if (++delayDecimCounter >= delayDecimation) {
+            int readIndex = delayIndex - delayLength;
+            if (readIndex < 0) readIndex += delayBufferSize;
+            delayHeld = delayBuffer[readIndex] / DELAY_SCALE;
+
+            // The input goes in at unity, so the first echo matches the dry
+            // level; feedback < 1 makes the repeats decay. The feedback path
+            // is damped and DC-blocked, or the voices' offset would build up.
+            delayDampState += DELAY_DAMPING * (delayHeld - delayDampState);
+            delayDcState += DELAY_DC_BLOCK * (delayDampState - delayDcState);
+            float writeSample = delayDecimAcc / delayDecimation + (delayDampState - delayDcState) * feedback;
+            float scaled = constrain(writeSample * DELAY_SCALE, -32768.0f, 32767.0f);
+            delayBuffer[delayIndex] = (int16_t)scaled;
+
+            delayIndex++;
+            if (delayIndex >= delayBufferSize) delayIndex = 0;
+            delayDecimAcc = 0.0f;
+            delayDecimCounter = 0;
+        }
+
+        block[n] = inputSample + (delayHeld - inputSample) * wet;
+    }
+}
 
-    if (settings.reverb_on)
-        wetSignal += applyReverb(inputSample) * (settings.reverb_strength / 255.0f) * 0.5f;
 
-    if (settings.distortion_on)
-        wetSignal += applyDistortion(inputSample) * (settings.distortion_strength / 255.0f) * 0.3f;
+//------------------------------------------------------------------------------
+// Effect Pipeline
+//------------------------------------------------------------------------------
+// The list of enabled stages is rebuilt only when an effect parameter group
+// changes version. Each stage processes a whole block, so with every effect off
+// the per-sample cost is zero. A stage that was just switched off stays in the
+// list for one more control block while its wet level ramps down to zero.
+const int EFFECT_BLOCK_SIZE = 64;
+const int MAX_EFFECT_STAGES = 4;
+
+typedef void (*EffectBlockFn)(float* block, int length);
+
+struct {
+    EffectBlockFn stages[MAX_EFFECT_STAGES];
+    int count = 0;
+    bool fading = false;
+} effectPipeline;
+
+void addEffectStage(EffectBlockFn process, bool on, const SmoothedParam& wet) {
+    if (!on && wet.current == 0.0f && wet.target == 0.0f) return;
+    if (!on) effectPipeline.fading = true;
+    if (effectPipeline.count >= MAX_EFFECT_STAGES) return;
+    effectPipeline.stages[effectPipeline.count++] = process;
+}
+
+void rebuildEffectPipeline() {
+    effectPipeline.count = 0;
+    effectPipeline.fading = false;
 
-    if (settings.chorus_on)
-        wetSignal += applyChorus(inputSample) * (settings.chorus_strength / 255.0f) * 0.3f;
+    // Stage order: distortion -> chorus -> delay -> reverb
+    addEffectStage(distortionBlock, backendSettings.distortion_on, distortionWet);
+    addEffectStage(chorusBlock, backendSettings.chorus_on, chorusWet);
+    addEffectStage(delayBlock, backendSettings.delay_on && delayBuffer != nullptr, delayWet);
+    addEffectStage(reverbBlock, backendSettings.reverb_on, reverbWet);
+}
 
-    // Combine dry and wet signals with a mix ratio of 70% dry and 30% wet
-    float output = (inputSample * 0.3f) + (wetSignal * 0.7f);
+// Called once per control block of `length` samples, before any effect block
+void updateEffectParams(int length) {
+    bool changed = effectPipeline.fading;
+
+    if (paramChanged(PARAM_DISTORTION)) {
+        distortionGain.setTarget(3.0f + (backendSettings.distortion_strength * 0.7f), length);
+        distortionWet.setTarget(backendSettings.distortion_on ? backendSettings.distortion_strength * 0.03f : 0.0f, length);
+        changed = true;
+    } else {
+        distortionGain.settle();
+        distortionWet.settle();
+    }
+
+    if (paramChanged(PARAM_CHORUS)) {
+        chorusDepth.setTarget(5 + backendSettings.chorus_strength * 2, length);
+        chorusWet.setTarget(backendSettings.chorus_on ? backendSettings.chorus_strength * 0.03f : 0.0f, length);
+        changed = true;
+    } else {
+        chorusDepth.settle();
+        chorusWet.settle();
+    }
+
+    if (paramChanged(PARAM_DELAY)) {
+        delayFeedback.setTarget(backendSettings.delay_strength * 0.08f, length);
+        delayWet.setTarget(backendSettings.delay_on ? DELAY_WET : 0.0f, length);
+        if (delayBuffer != nullptr) {
+            delayLength = delayTimeSamples(backendSettings.metronome.speed, backendSettings.delay_division) / delayDecimation;
+            delayLength = constrain(delayLength, 1, delayBufferSize - 1);
+        }
+        changed = true;
+    } else {
+        delayFeedback.settle();
+        delayWet.settle();
+    }
+
+    if (paramChanged(PARAM_REVERB)) {
+        reverbDecay.setTarget(0.2f + (backendSettings.reverb_strength * 0.06f), length);
+        reverbWet.setTarget(backendSettings.reverb_on ? backendSettings.reverb_strength * 0.05f : 0.0f, length);
+        changed = true;
+    } else {
+        reverbDecay.settle();
+        reverbWet.settle();
+    }
+
+    if (changed) rebuildEffectPipeline();
+}
 
-    return output;
+void runEffectPipeline(float* block, int length) {
+    for (int i = 0; i < effectPipeline.count; i++) {
+        effectPipeline.stages[i](block, length);
+    }
 }
 
 #endif
@@ -0,0 +1,30 @@
+#ifndef EQ_H
+#define EQ_H
+
+#include "pin.h"
+#include "params.h"
+#include "eqbands.h"
+
+// -------------------- Master EQ Settings --------------------
+// Called once per control block
+void updateEQParams() {
+    if (!paramChanged(PARAM_EQ)) return;
+
+    bool wasActive[EQ_BANDS] = {false};
+    for (int b = 0; b < eqActiveBands; b++) wasActive[eqActive[b]] = true;
+
+    eqActiveBands = 0;
+    if (!backendSettings.eq.on) return;
+
+    for (int i = 0; i < EQ_BANDS; i++) {
+        if (backendSettings.eq.gain[i] == 0) continue;
+        designBiquad(eqBiquads[i], eqShapes[i], backendSettings.eq.gain[i] * EQ_DB_PER_STEP);
+        // A band coming back in starts from clean state
+        if (!wasActive[i]) {
+            eqBiquads[i].x1 = eqBiquads[i].x2 = eqBiquads[i].y1 = eqBiquads[i].y2 = 0;
+        }
+        eqActive[eqActiveBands++] = i;
+    }
+}
+
+#endif
@@ -0,0 +1,149 @@
+#ifndef EQBANDS_H
+#define EQBANDS_H
+
+#include <algorithm>
+#include <math.h>
+#include <stdint.h>
+
+// -------------------- Master EQ --------------------
+// Cascaded direct form I biquads in fixed point. Samples are Q20 (8-bit full
+// scale 256 = 2^28, leaving 18 dB of accumulator headroom) and coefficients
+// are Q29 so shelf coefficients up to +/-4 fit. Each band runs over the whole
+// block before the next one; coefficients are only recomputed when PARAM_EQ
+// changes.
+//
+// The mix is unipolar (silence is 0), and the low shelf's DC gain would
+// multiply that offset by up to 4 and clip the output. The bands run on the
+// signal minus a slow running mean (about 10 Hz), which is added back after.
+// Plain C++, so tools/eqbench.cpp times the same code; eq.h maps the settings.
+#ifndef SAMPLE_RATE
+#define SAMPLE_RATE 22000                       // As in pin.h, for host builds
+#endif
+const int EQ_BANDS = 3;
+const int EQ_SAMPLE_SHIFT = 20;
+const int EQ_COEF_SHIFT = 29;
+const float EQ_DB_PER_STEP = 3.0f;
+const int EQ_BLOCK_SIZE = 64;
+const float EQ_DC_TRACK = 0.003f;           // One-pole mean, ~10 Hz at 22 kHz
+
+enum EqBandType { EQ_LOW_SHELF, EQ_PEAK, EQ_HIGH_SHELF };
+
+struct EqBandShape {
+    EqBandType type;
+    float freq;
+    float q;
+};
+
+const EqBandShape eqShapes[EQ_BANDS] = {
+    {EQ_LOW_SHELF, 200.0f, 0.707f},
+    {EQ_PEAK, 1200.0f, 0.9f},
+    {EQ_HIGH_SHELF, 5000.0f, 0.707f}
+};
+
+struct Biquad {
+    int32_t b0, b1, b2, a1, a2;   // Q29, a0 normalised to 1
+    int32_t x1, x2, y1, y2;
+};
+
+Biquad eqBiquads[EQ_BANDS];
+int eqActiveBands = 0;            // Bands with non-zero gain, listed in eqActive
+int eqActive[EQ_BANDS];
+int32_t eqScratch[EQ_BLOCK_SIZE];
+float eqMeanScratch[EQ_BLOCK_SIZE];
+float eqMean = 0.0f;                        // Running DC level of the input
+
+inline int32_t saturateQ31(int64_t value) {
+    if (value > INT32_MAX) return INT32_MAX;
+    if (value < INT32_MIN) return INT32_MIN;
+    return (int32_t)value;
+}
+
+// RBJ cookbook coefficients, computed in float at control rate only
+void designBiquad(Biquad& bq, const EqBandShape& shape, float gainDb) {
+    float A = powf(10.0f, gainDb / 40.0f);
+    float w0 = 2.0f * (float)M_PI * shape.freq / SAMPLE_RATE;
+    float cosw = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * shape.q);
+    float sqrtA2alpha = 2.0f * sqrtf(A) * alpha;
+    float b0, b1, b2, a0, a1, a2;
+
+    switch (shape.type) {
+        case EQ_LOW_SHELF:
+            b0 = A * ((A + 1) - (A - 1) * cosw + sqrtA2alpha);
+            b1 = 2 * A * ((A - 1) - (A + 1) * cosw);
+            b2 = A * ((A + 1) - (A - 1) * cosw - sqrtA2alpha);
+            a0 = (A + 1) + (A - 1) * cosw + sqrtA2alpha;
+            a1 = -2 * ((A - 1) + (A + 1) * cosw);
+            a2 = (A + 1) + (A - 1) * cosw - sqrtA2alpha;
+            break;
+        case EQ_HIGH_SHELF:
+            b0 = A * ((A + 1) + (A - 1) * cosw + sqrtA2alpha);
+            b1 = -2 * A * ((A - 1) + (A + 1) * cosw);
+            b2 = A * ((A + 1) + (A - 1) * cosw - sqrtA2alpha);
+            a0 = (A + 1) - (A - 1) * cosw + sqrtA2alpha;
+            a1 = 2 * ((A - 1) - (A + 1) * cosw);
+            a2 = (A + 1) - (A - 1) * cosw - sqrtA2alpha;
+            break;
+        default:
+            b0 = 1 + alpha * A;
+            b1 = -2 * cosw;
+            b2 = 1 - alpha * A;
+            a0 = 1 + alpha / A;
+            a1 = -2 * cosw;
+            a2 = 1 - alpha / A;
+            break;
+    }
+
+    const float scale = (float)(1u << EQ_COEF_SHIFT) / a0;
+    bq.b0 = (int32_t)lrintf(b0 * scale);
+    bq.b1 = (int32_t)lrintf(b1 * scale);
+    bq.b2 = (int32_t)lrintf(b2 * scale);
+    bq.a1 = (int32_t)lrintf(a1 * scale);
+    bq.a2 = (int32_t)lrintf(a2 * scale);
+}
+
+// One band over a block, in place
+void biquadBlock(Biquad& bq, int32_t* block, int length) {
+    int32_t x1 = bq.x1, x2 = bq.x2, y1 = bq.y1, y2 = bq.y2;
+    for (int n = 0; n < length; n++) {
+        int32_t x = block[n];
+        int64_t acc = (int64_t)bq.b0 * x + (int64_t)bq.b1 * x1 + (int64_t)bq.b2 * x2
+                    - (int64_t)bq.a1 * y1 - (int64_t)bq.a2 * y2;
+        int32_t y = saturateQ31(acc >> EQ_COEF_SHIFT);
+        x2 = x1; x1 = x;
+        y2 = y1; y1 = y;
+        block[n] = y;
+    }
+    bq.x1 = x1; bq.x2 = x2; bq.y1 = y1; bq.y2 = y2;
+}
+
+// Silence path: the output is written as 0 without running the bands, so
+// drop the last note's state rather than resume from it
+void eqReset() {
+    for (int i = 0; i < EQ_BANDS; i++) {
+        eqBiquads[i].x1 = eqBiquads[i].x2 = eqBiquads[i].y1 = eqBiquads[i].y2 = 0;
+    }
+    eqMean = 0.0f;
+}
+
+void eqBlock(float* block, int length) {
+    if (eqActiveBands == 0) return;
+
+    const float toQ = (float)(1u << EQ_SAMPLE_SHIFT);
+    const float fromQ = 1.0f / toQ;
+    float mean = eqMean;
+    for (int offset = 0; offset < length; offset += EQ_BLOCK_SIZE) {
+        int count = std::min(EQ_BLOCK_SIZE, length - offset);
+        for (int n = 0; n < count; n++) {
+            float x = block[offset + n];
+            mean += EQ_DC_TRACK * (x - mean);
+            eqMeanScratch[n] = mean;
+            eqScratch[n] = (int32_t)((x - mean) * toQ);
+        }
+        for (int b = 0; b < eqActiveBands; b++) biquadBlock(eqBiquads[eqActive[b]], eqScratch, count);
+        for (int n = 0; n < count; n++) block[offset + n] = eqScratch[n] * fromQ + eqMeanScratch[n];
+    }
+    eqMean = mean;
+}
+
+#endif
@@ -0,0 +1,246 @@
+#ifndef FM_H
+#define FM_H
+
+#include "pin.h"
+#include "params.h"
+#include "voices.h"
+#include "bend.h"
+#include <math.h>
+
+// -------------------- FM Voice Engine --------------------
+// Up to four sine operators per voice on 32-bit phase accumulators and a Q15
+// sine table. Each algorithm is a template instance, so the per-sample loop
+// has no routing branches: one operator costs a table lookup, a multiply for
+// its envelope and a multiply to scale its phase modulation.
+const int FM_SINE_BITS = 9;
+const int FM_SINE_SIZE = 1 << FM_SINE_BITS;
+const int FM_ENV_ONE = 1 << 30;            // Envelope full scale (Q30)
+
+enum FmAlgorithm {
+    FM_ALG_2OP,      // 1 -> 0
+    FM_ALG_STACK,    // 3 -> 2 -> 1 -> 0
+    FM_ALG_PAIRS,    // 1 -> 0, 3 -> 2 (two carriers)
+    FM_ALG_BRANCH,   // 3 -> 2 -> 0, 1 -> 0
+    FM_ALG_COUNT
+};
+
+int16_t fmSineTable[FM_SINE_SIZE];
+
+enum FmEnvStage { FM_ENV_ATTACK, FM_ENV_DECAY, FM_ENV_SUSTAIN, FM_ENV_RELEASE, FM_ENV_OFF };
+
+// Per-sample rates in Q30 units, derived from the times below in fmInit()
+struct FmEnvShape {
+    float attackTime;
+    float decayTime;
+    float sustainLevel;
+    float releaseTime;
+    int32_t attackRate, decayRate, sustain, releaseRate;
+};
+
+// Selectable per operator. Auto picks by role: carriers ring, modulators
+// decay faster so the timbre brightens on attack.
+enum FmEnvPreset { FM_ENV_AUTO, FM_ENV_RING, FM_ENV_BITE, FM_ENV_PLUCK, FM_ENV_PAD, FM_ENV_ORGAN, FM_ENV_PRESETS };
+const char* const fmEnvNames[FM_ENV_PRESETS] = {"Auto", "Ring", "Bite", "Plk", "Pad", "Org"};
+
+FmEnvShape fmEnvShapes[FM_ENV_PRESETS] = {
+    {0.005f, 1.5f,  0.7f, 0.2f},     // Auto: resolved to Ring or Bite, never used itself
+    {0.005f, 1.5f,  0.7f, 0.2f},     // Ring
+    {0.002f, 0.4f,  0.3f, 0.15f},    // Bite
+    {0.001f, 0.25f, 0.0f, 0.1f},     // Pluck
+    {0.4f,   1.0f,  0.8f, 0.8f},     // Pad
+    {0.005f, 0.05f, 1.0f, 0.05f},    // Organ
+};
+
+const FmEnvShape* fmOpEnv[FM_OPERATORS];    // Resolved per operator on PARAM_FM
+
+struct FmOperator {
+    uint32_t phase;
+    uint32_t inc;
+    int32_t env;           // Q30
+    int32_t envStep;       // Per sample, for the current block
+    FmEnvStage stage;
+};
+
+struct FmVoice {
+    FmOperator op[FM_OPERATORS];
+};
+
+FmVoice fmVoices[MAX_VOICES];
+uint32_t fmModScale = 0;     // Q15 operator output -> phase offset
+uint32_t fmPitchVersion = 0; // pitchTableVersion the increments were set with
+int fmAlgorithm = FM_ALG_2OP;
+
+// Ops that are carriers for each algorithm (bit per op)
+const uint8_t fmCarrierMask[FM_ALG_COUNT] = {0x1, 0x1, 0x5, 0x1};
+
+void fmSetEnvRates(FmEnvShape& shape) {
+    shape.attackRate = (int32_t)(FM_ENV_ONE / (shape.attackTime * SAMPLE_RATE));
+    shape.decayRate = (int32_t)(FM_ENV_ONE / (shape.decayTime * SAMPLE_RATE));
+    shape.sustain = (int32_t)(FM_ENV_ONE * shape.sustainLevel);
+    shape.releaseRate = (int32_t)(FM_ENV_ONE / (shape.releaseTime * SAMPLE_RATE));
+}
+
+// Operator envelopes for the current algorithm and settings
+void fmSetEnvelopes() {
+    for (int op = 0; op < FM_OPERATORS; op++) {
+        int preset = constrain(backendSettings.fm.env[op], 0, FM_ENV_PRESETS - 1);
+        if (preset == FM_ENV_AUTO) preset = (fmCarrierMask[fmAlgorithm] >> op & 1) ? FM_ENV_RING : FM_ENV_BITE;
+        fmOpEnv[op] = &fmEnvShapes[preset];
+    }
+}
+
+void fmInit() {
+    for (int i = 0; i < FM_SINE_SIZE; i++) {
+        fmSineTable[i] = (int16_t)lrintf(32767.0f * sinf(2.0f * PI * i / FM_SINE_SIZE));
+    }
+    for (int i = 0; i < FM_ENV_PRESETS; i++) fmSetEnvRates(fmEnvShapes[i]);
+    fmSetEnvelopes();
+}
+
+// Operator ratios: carriers at 1, modulators at the selected ratio
+void fmSetIncrements(FmVoice& voice, int note) {
+    uint32_t base = bentPhaseIncs[note];
+    uint32_t ratio = backendSettings.fm.ratio;
+    for (int op = 0; op < FM_OPERATORS; op++) {
+        voice.op[op].inc = (fmCarrierMask[fmAlgorithm] >> op & 1) ? base : base * ratio;
+    }
+}
+
+void fmStartVoice(int slot, int note) {
+    FmVoice& voice = fmVoices[slot];
+    fmSetIncrements(voice, note);
+    for (int op = 0; op < FM_OPERATORS; op++) {
+        voice.op[op].phase = 0;
+        voice.op[op].env = 0;
+        voice.op[op].stage = FM_ENV_ATTACK;
+    }
+}
+
+void fmReleaseVoice(int slot) {
+    for (int op = 0; op < FM_OPERATORS; op++) {
+        if (fmVoices[slot].op[op].stage != FM_ENV_OFF) fmVoices[slot].op[op].stage = FM_ENV_RELEASE;
+    }
+}
+
+// Advance one envelope by a whole block and set its per-sample ramp.
+// Stage changes are resolved at block granularity.
+void fmEnvelopeBlock(FmOperator& op, const FmEnvShape& shape, int length) {
+    int64_t level = op.env;
+    switch (op.stage) {
+        case FM_ENV_ATTACK:
+            level += (int64_t)shape.attackRate * length;
+            if (level >= FM_ENV_ONE) { level = FM_ENV_ONE; op.stage = FM_ENV_DECAY; }
+            break;
+        case FM_ENV_DECAY:
+            level -= (int64_t)shape.decayRate * length;
+            if (level <= shape.sustain) { level = shape.sustain; op.stage = FM_ENV_SUSTAIN; }
+            break;
+        case FM_ENV_SUSTAIN:
+            level = shape.sustain;
+            break;
+        case FM_ENV_RELEASE:
+            level -= (int64_t)shape.releaseRate * length;
+            if (level <= 0) { level = 0; op.stage = FM_ENV_OFF; }
+            break;
+        default:
+            level = 0;
+            break;
+    }
+    op.envStep = (int32_t)((level - op.env) / length);
+}
+
+// One operator sample: Q15 output scaled by its envelope
+inline int32_t fmOperator(FmOperator& op, uint32_t modOffset) {
+    op.env += op.envStep;
+    int32_t s = fmSineTable[(op.phase + modOffset) >> (32 - FM_SINE_BITS)];
+    op.phase += op.inc;
+    return (s * (op.env >> 15)) >> 15;
+}
+
+inline uint32_t fmMod(int32_t out) {
+    return (uint32_t)out * fmModScale;
+}
+
+// Render one voice for a block; returns nothing, accumulates unipolar output.
+// Carrier output is offset by its own envelope so silence stays at zero.
+template <int ALG>
+void fmRenderVoice(FmVoice& v, float* block, int length, float gain) {
+    FmOperator* op = v.op;
+    for (int n = 0; n < length; n++) {
+        int32_t out;
+        if (ALG == FM_ALG_2OP) {
+            int32_t o1 = fmOperator(op[1], 0);
+            out = fmOperator(op[0], fmMod(o1)) + (op[0].env >> 15);
+        } else if (ALG == FM_ALG_STACK) {
+            int32_t o3 = fmOperator(op[3], 0);
+            int32_t o2 = fmOperator(op[2], fmMod(o3));
+            int32_t o1 = fmOperator(op[1], fmMod(o2));
+            out = fmOperator(op[0], fmMod(o1)) + (op[0].env >> 15);
+        } else if (ALG == FM_ALG_PAIRS) {
+            int32_t o1 = fmOperator(op[1], 0);
+            int32_t o3 = fmOperator(op[3], 0);
+            out = fmOperator(op[0], fmMod(o1)) + (op[0].env >> 15)
+                + fmOperator(op[2], fmMod(o3)) + (op[2].env >> 15);
+        } else {
+            int32_t o3 = fmOperator(op[3], 0);
+            int32_t o2 = fmOperator(op[2], fmMod(o3));
+            int32_t o1 = fmOperator(op[1], 0);
+            out = fmOperator(op[0], fmMod(o1) + fmMod(o2)) + (op[0].env >> 15);
+        }
+        block[n] += out * gain;
+    }
+}
+
+typedef void (*FmRenderFn)(FmVoice&, float*, int, float);
+const FmRenderFn fmRenderers[FM_ALG_COUNT] = {
+    fmRenderVoice<FM_ALG_2OP>,
+    fmRenderVoice<FM_ALG_STACK>,
+    fmRenderVoice<FM_ALG_PAIRS>,
+    fmRenderVoice<FM_ALG_BRANCH>
+};
+
+// Called once per block; returns true while any voice is sounding
+bool fmRenderBlock(float* block, int length, int volume) {
+    bool retune = fmPitchVersion != pitchTableVersion;
+    if (paramChanged(PARAM_FM)) {
+        fmAlgorithm = constrain(backendSettings.fm.algorithm, 0, FM_ALG_COUNT - 1);
+        fmSetEnvelopes();
+        // Index 0..10 maps to 0..5 rad of peak phase deviation
+        fmModScale = (uint32_t)(backendSettings.fm.index * 0.5f * 4294967296.0f / (2.0f * PI) / 32768.0f);
+        retune = true;
+    }
+    if (retune) {
+        fmPitchVersion = pitchTableVersion;
+        for (int v = 0; v < MAX_VOICES; v++) {
+            if (voicePool.slots[v].note >= 0) fmSetIncrements(fmVoices[v], voicePool.slots[v].note);
+        }
+    }
+
+    voicePoolScan(fmStartVoice, fmReleaseVoice);
+
+    memset(block, 0, length * sizeof(float));
+    int sounding = voicesSounding();
+    if (sounding == 0) return false;
+
+    // Unipolar Q15 sum -> 8-bit units with the volume shift, averaged like the table voices
+    int carriers = (fmCarrierMask[fmAlgorithm] == 0x5) ? 2 : 1;
+    float gain = ldexpf(255.0f, volume - 8) / (65536.0f * carriers * sounding);
+
+    FmRenderFn render = fmRenderers[fmAlgorithm];
+    for (int v = 0; v < MAX_VOICES; v++) {
+        if (voicePool.slots[v].note < 0) continue;
+        FmVoice& voice = fmVoices[v];
+
+        bool audible = false;
+        for (int op = 0; op < FM_OPERATORS; op++) {
+            fmEnvelopeBlock(voice.op[op], *fmOpEnv[op], length);
+            if ((fmCarrierMask[fmAlgorithm] >> op & 1) && voice.op[op].stage != FM_ENV_OFF) audible = true;
+        }
+
+        render(voice, block, length, gain);
+        if (!audible) voiceFree(v);
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef INPUTFIELDS_H
+#define INPUTFIELDS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// -------------------- Input Matrix Fields --------------------
+// No dependencies, so tools/inputbench.cpp measures the same field reads the
+// firmware uses.
+const size_t inputSize = 28;
+
+// The matrix is kept as one packed word, bit = row * 4 + column, active low.
+// Each field is a (shift, width) pair, so a read is one shift and one mask.
+struct InputField {
+    uint8_t shift;
+    uint8_t width;
+    constexpr uint32_t mask() const { return ((1u << width) - 1) << shift; }
+    constexpr uint32_t operator()(uint32_t word) const { return (word >> shift) & ((1u << width) - 1); }
+};
+
+constexpr InputField INPUT_KEYS           = {0, 12};
+constexpr InputField INPUT_KNOBS          = {12, 8};   // Quadrature, knob 3 lowest
+constexpr InputField INPUT_CLICKS_23      = {20, 2};   // Clicks of knobs 2 and 3
+constexpr InputField INPUT_JOYSTICK_PRESS = {22, 1};
+constexpr InputField INPUT_WEST_DETECT    = {23, 1};
+constexpr InputField INPUT_CLICKS_01      = {24, 2};   // Clicks of knobs 0 and 1
+constexpr InputField INPUT_EAST_DETECT    = {27, 1};
+constexpr uint32_t INPUT_IDLE = (1u << inputSize) - 1; // Nothing pressed
+
+// A/B pair of knob 0..3
+constexpr InputField inputKnob(int k) {
+    return {(uint8_t)(INPUT_KNOBS.shift + 2 * (3 - k)), 2};
+}
+
+// Click bit i belongs to knob i
+inline uint32_t inputClicks(uint32_t word) {
+    return INPUT_CLICKS_23(word) << 2 | INPUT_CLICKS_01(word);
+}
+
+#endif
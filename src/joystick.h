@@ -0,0 +1,170 @@
+#ifndef JOYSTICK_H
+#define JOYSTICK_H
+
+#include "pin.h"
+
+// -------------------- Joystick ADC Sampling --------------------
+// ADC1 converts both axes continuously in scan mode, 16x oversampled in
+// hardware, and DMA writes the results into a small circular buffer with no
+// interrupts. A read averages the whole buffer, so the task costs a few
+// additions however often it polls. The centre is measured at start-up.
+// Results are published lock-free: the axes as signed positions for
+// real-time control, and menu moves as a gesture that fires when the stick
+// returns to the centre.
+const int JOY_DMA_FRAMES = 8;                  // X/Y pairs, about 8 ms of samples
+const int JOY_DEFAULT_CENTRE = 490;            // 10-bit, used if calibration fails
+const int JOY_CALIBRATION_LIMIT = 150;         // Max plausible offset of the centre from mid-scale
+const int JOY_CALIBRATION_READS = 16;
+const int JOY_AXIS_SCALE = 1024;               // Full deflection
+const int JOY_AXIS_DEAD_ZONE = 24;             // Keeps analog control still at rest
+const int JOY_GESTURE_ON = 150;                // Offset that starts a gesture
+const int JOY_GESTURE_OFF = 100;               // Offset back inside which it completes
+
+enum JoystickGesture : uint8_t { JOY_NONE, JOY_LEFT, JOY_RIGHT, JOY_UP, JOY_DOWN };
+
+ADC_HandleTypeDef joystickAdc;
+DMA_HandleTypeDef joystickDma;
+volatile uint16_t joystickDmaBuffer[JOY_DMA_FRAMES * 2];
+
+// Written by scanJoystickTask, read by anyone
+int32_t joystickX = 0;                         // Right is positive, +/-JOY_AXIS_SCALE
+int32_t joystickY = 0;                         // Up is positive
+uint8_t joystickGesture = JOY_NONE;            // Latest completed gesture, until taken
+
+struct {
+    int centreX = JOY_DEFAULT_CENTRE;
+    int centreY = JOY_DEFAULT_CENTRE;
+    JoystickGesture held = JOY_NONE;           // Direction currently pushed
+} joystick;
+
+uint32_t joystickAdcChannel(int pin) {
+    uint32_t function = pinmap_function(analogInputToPinName(pin), PinMap_ADC);
+    return __LL_ADC_DECIMAL_NB_TO_CHANNEL(STM_PIN_CHANNEL(function));
+}
+
+// From setup(); false if the ADC or DMA could not be started
+bool joystickStart() {
+    pinmap_pinout(analogInputToPinName(JOYX_PIN), PinMap_ADC);
+    pinmap_pinout(analogInputToPinName(JOYY_PIN), PinMap_ADC);
+
+    __HAL_RCC_DMA1_CLK_ENABLE();
+    joystickDma.Instance = DMA1_Channel1;
+    joystickDma.Init.Request = DMA_REQUEST_0;
+    joystickDma.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    joystickDma.Init.PeriphInc = DMA_PINC_DISABLE;
+    joystickDma.Init.MemInc = DMA_MINC_ENABLE;
+    joystickDma.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+    joystickDma.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+    joystickDma.Init.Mode = DMA_CIRCULAR;
+    joystickDma.Init.Priority = DMA_PRIORITY_LOW;
+    if (HAL_DMA_Init(&joystickDma) != HAL_OK) return false;
+
+    joystickAdc.Instance = ADC1;
+    joystickAdc.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV4;
+    joystickAdc.Init.Resolution = ADC_RESOLUTION_12B;
+    joystickAdc.Init.DataAlign = ADC_DATAALIGN_RIGHT;
+    joystickAdc.Init.ScanConvMode = ADC_SCAN_ENABLE;
+    joystickAdc.Init.EOCSelection = ADC_EOC_SEQ_CONV;
+    joystickAdc.Init.LowPowerAutoWait = DISABLE;
+    joystickAdc.Init.ContinuousConvMode = ENABLE;
+    joystickAdc.Init.NbrOfConversion = 2;
+    joystickAdc.Init.DiscontinuousConvMode = DISABLE;
+    joystickAdc.Init.ExternalTrigConv = ADC_SOFTWARE_START;
+    joystickAdc.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_NONE;
+    joystickAdc.Init.DMAContinuousRequests = ENABLE;
+    joystickAdc.Init.Overrun = ADC_OVR_DATA_OVERWRITTEN;
+    joystickAdc.Init.OversamplingMode = ENABLE;
+    joystickAdc.Init.Oversampling.Ratio = ADC_OVERSAMPLING_RATIO_16;
+    joystickAdc.Init.Oversampling.RightBitShift = ADC_RIGHTBITSHIFT_4;
+    joystickAdc.Init.Oversampling.TriggeredMode = ADC_TRIGGEREDMODE_SINGLE_TRIGGER;
+    joystickAdc.Init.Oversampling.OversamplingStopReset = ADC_REGOVERSAMPLING_CONTINUED_MODE;
+    if (HAL_ADC_Init(&joystickAdc) != HAL_OK) return false;
+    __HAL_LINKDMA(&joystickAdc, DMA_Handle, joystickDma);
+
+    const int pins[2] = {JOYX_PIN, JOYY_PIN};
+    for (int i = 0; i < 2; i++) {
+        ADC_ChannelConfTypeDef channel = {};
+        channel.Channel = joystickAdcChannel(pins[i]);
+        channel.Rank = (i == 0) ? ADC_REGULAR_RANK_1 : ADC_REGULAR_RANK_2;
+        channel.SamplingTime = ADC_SAMPLETIME_640CYCLES_5;
+        channel.SingleDiff = ADC_SINGLE_ENDED;
+        channel.OffsetNumber = ADC_OFFSET_NONE;
+        if (HAL_ADC_ConfigChannel(&joystickAdc, &channel) != HAL_OK) return false;
+    }
+
+    HAL_ADCEx_Calibration_Start(&joystickAdc, ADC_SINGLE_ENDED);
+    return HAL_ADC_Start_DMA(&joystickAdc, (uint32_t*)joystickDmaBuffer, JOY_DMA_FRAMES * 2) == HAL_OK;
+}
+
+// Both axes averaged over the buffer, 10-bit like analogRead
+void joystickRead(int& x, int& y) {
+    uint32_t sumX = 0, sumY = 0;
+    for (int i = 0; i < JOY_DMA_FRAMES; i++) {
+        sumX += joystickDmaBuffer[2 * i];
+        sumY += joystickDmaBuffer[2 * i + 1];
+    }
+    x = sumX / (JOY_DMA_FRAMES * 4);
+    y = sumY / (JOY_DMA_FRAMES * 4);
+}
+
+// Task start-up, stick assumed at rest; a reading far off mid-scale means
+// it's being held, so keep the default
+void joystickCalibrate() {
+    int sumX = 0, sumY = 0;
+    for (int i = 0; i < JOY_CALIBRATION_READS; i++) {
+        vTaskDelay(JOY_DMA_FRAMES / portTICK_PERIOD_MS);
+        int x, y;
+        joystickRead(x, y);
+        sumX += x;
+        sumY += y;
+    }
+    int x = sumX / JOY_CALIBRATION_READS;
+    int y = sumY / JOY_CALIBRATION_READS;
+    if (abs(x - 512) <= JOY_CALIBRATION_LIMIT && abs(y - 512) <= JOY_CALIBRATION_LIMIT) {
+        joystick.centreX = x;
+        joystick.centreY = y;
+    }
+}
+
+// Offset (centre - reading) scaled to +/-JOY_AXIS_SCALE, zero inside the dead zone
+int joystickAxis(int offset, int centre) {
+    if (abs(offset) <= JOY_AXIS_DEAD_ZONE) return 0;
+    int span = (offset > 0) ? centre - JOY_AXIS_DEAD_ZONE : 1023 - centre - JOY_AXIS_DEAD_ZONE;
+    int scaled = (offset - (offset > 0 ? JOY_AXIS_DEAD_ZONE : -JOY_AXIS_DEAD_ZONE)) * JOY_AXIS_SCALE / span;
+    return constrain(scaled, -JOY_AXIS_SCALE, JOY_AXIS_SCALE);
+}
+
+// Offsets are right / up positive. A gesture completes when the stick comes
+// back inside JOY_GESTURE_OFF; X wins when both axes are pushed.
+JoystickGesture joystickClassify(int dx, int dy) {
+    if (joystick.held == JOY_NONE) {
+        if (abs(dx) > JOY_GESTURE_ON) joystick.held = (dx > 0) ? JOY_RIGHT : JOY_LEFT;
+        else if (abs(dy) > JOY_GESTURE_ON) joystick.held = (dy > 0) ? JOY_UP : JOY_DOWN;
+        return JOY_NONE;
+    }
+    if (abs(dx) > JOY_GESTURE_OFF || abs(dy) > JOY_GESTURE_OFF) return JOY_NONE;
+    JoystickGesture done = joystick.held;
+    joystick.held = JOY_NONE;
+    return done;
+}
+
+// One poll: publish both axes and any completed gesture
+void joystickPoll() {
+    int x, y;
+    joystickRead(x, y);
+    // The stick reads higher to the left and down
+    int dx = joystick.centreX - x;
+    int dy = joystick.centreY - y;
+    __atomic_store_n(&joystickX, joystickAxis(dx, joystick.centreX), __ATOMIC_RELAXED);
+    __atomic_store_n(&joystickY, joystickAxis(dy, joystick.centreY), __ATOMIC_RELAXED);
+
+    JoystickGesture gesture = joystickClassify(dx, dy);
+    if (gesture != JOY_NONE) __atomic_store_n(&joystickGesture, gesture, __ATOMIC_RELEASE);
+}
+
+// Consumer side: the latest gesture, once
+inline JoystickGesture joystickTakeGesture() {
+    return (JoystickGesture)__atomic_exchange_n(&joystickGesture, JOY_NONE, __ATOMIC_ACQUIRE);
+}
+
+#endif
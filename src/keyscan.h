@@ -0,0 +1,143 @@
+#ifndef KEYSCAN_H
+#define KEYSCAN_H
+
+#include "pin.h"
+#include "quadrature.h"
+#include "profile.h"
+
+// -------------------- Timer-Driven Key Matrix Scanner --------------------
+// A hardware timer ticks KEYSCAN_ROWS times per millisecond. Each tick reads
+// the columns of the row selected on the previous tick (which has had a whole
+// tick to settle, so no busy-wait) and then selects the next row, all through
+// the GPIO BSRR/IDR registers. After the last row the knobs are decoded, the
+// full word is debounced and published, and every key that changed raises a
+// KeyEvent.
+//
+// Keys, knob clicks and the joystick button use a per-bit integrator: the
+// count moves one step towards the raw level each scan and the output only
+// flips at 0 or KEYSCAN_DEBOUNCE. Knob quadrature and the West/East detect
+// lines pass through as scanned; the knobs are decoded from the raw scan.
+const int KEYSCAN_ROWS = inputSize / 4;
+const int KEYSCAN_RATE = 1000 * KEYSCAN_ROWS;      // Ticks per second, one full scan per ms
+const int KEYSCAN_DEBOUNCE = 4;                    // Scans (ms) a level must hold
+const uint32_t KEYSCAN_DEBOUNCED_BITS = INPUT_KEYS.mask() | INPUT_CLICKS_01.mask() |
+                                        INPUT_CLICKS_23.mask() | INPUT_JOYSTICK_PRESS.mask();
+
+struct KeyEvent {
+    uint8_t key;            // 0..11
+    bool pressed;
+};
+
+struct GpioPin {
+    GPIO_TypeDef* port;
+    uint32_t mask;
+};
+
+QueueHandle_t keyEventQ = NULL;
+uint32_t keyEventOverflows = 0;                    // Key edges lost to a full keyEventQ
+
+struct {
+    GpioPin rowAddress[3];
+    GpioPin rowEnable;
+    GpioPin columns[4];
+    uint8_t row = 0;
+    uint32_t raw = 0;                              // Word being assembled
+    uint8_t integrator[inputSize];
+    uint32_t debounced = INPUT_IDLE;
+    uint32_t scans = 0;                            // Full scans, i.e. ms
+} keyScan;
+
+// Latest debounced input word, laid out like sysState.inputs
+uint32_t keyScanState = INPUT_IDLE;
+
+GpioPin gpioPin(int pin) {
+    uint32_t name = digitalPinToPinName(pin);
+    return {get_GPIO_Port(STM_PORT(name)), STM_GPIO_PIN(name)};
+}
+
+inline void gpioWrite(const GpioPin& pin, bool high) {
+    pin.port->BSRR = high ? pin.mask : pin.mask << 16;
+}
+
+inline bool gpioRead(const GpioPin& pin) {
+    return (pin.port->IDR & pin.mask) != 0;
+}
+
+void keyScanSelectRow(uint8_t row) {
+    gpioWrite(keyScan.rowEnable, false);
+    for (int b = 0; b < 3; b++) gpioWrite(keyScan.rowAddress[b], row >> b & 1);
+    gpioWrite(keyScan.rowEnable, true);
+}
+
+// Full scan done: integrate, publish, and queue key changes
+void keyScanDebounce(BaseType_t* woken) {
+    uint32_t raw = keyScan.raw;
+    uint32_t state = keyScan.debounced;
+    quadratureScan(raw, ++keyScan.scans);
+    for (int bit = 0; bit < inputSize; bit++) {
+        uint32_t mask = 1u << bit;
+        if (!(KEYSCAN_DEBOUNCED_BITS & mask)) {
+            state = (state & ~mask) | (raw & mask);
+            continue;
+        }
+        uint8_t& count = keyScan.integrator[bit];
+        if (raw & mask) {
+            if (count < KEYSCAN_DEBOUNCE && ++count == KEYSCAN_DEBOUNCE) state |= mask;
+        } else {
+            if (count > 0 && --count == 0) state &= ~mask;
+        }
+    }
+
+    uint32_t changed = (state ^ keyScan.debounced) & INPUT_KEYS.mask();
+    keyScan.debounced = state;
+    __atomic_store_n(&keyScanState, state, __ATOMIC_RELEASE);
+
+    while (changed) {
+        int key = __builtin_ctz(changed);
+        changed &= changed - 1;
+        KeyEvent event = {(uint8_t)key, !(state >> key & 1)};   // Keys are active low
+        if (xQueueSendFromISR(keyEventQ, &event, woken) != pdTRUE) {
+            __atomic_add_fetch(&keyEventOverflows, 1, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+void keyScanISR() {
+    profileBegin(PROF_KEYSCAN_ISR);
+    BaseType_t woken = pdFALSE;
+    uint32_t cols = 0;
+    for (int c = 0; c < 4; c++) cols |= (uint32_t)gpioRead(keyScan.columns[c]) << c;
+    int shift = keyScan.row * 4;
+    keyScan.raw = (keyScan.raw & ~(0xFu << shift)) | cols << shift;
+
+    if (++keyScan.row == KEYSCAN_ROWS) {
+        keyScan.row = 0;
+        keyScanDebounce(&woken);
+    }
+    keyScanSelectRow(keyScan.row);
+    profileEnd(PROF_KEYSCAN_ISR);
+    portYIELD_FROM_ISR(woken);
+}
+
+// After the start-up handshake, which still uses readInputs(); the scanner
+// owns the row mux from here on
+void keyScanStart(TIM_TypeDef* timerInstance) {
+    keyEventQ = xQueueCreate(32, sizeof(KeyEvent));
+    const int rowPins[3] = {RA0_PIN, RA1_PIN, RA2_PIN};
+    const int colPins[4] = {C0_PIN, C1_PIN, C2_PIN, C3_PIN};
+    for (int b = 0; b < 3; b++) keyScan.rowAddress[b] = gpioPin(rowPins[b]);
+    for (int c = 0; c < 4; c++) keyScan.columns[c] = gpioPin(colPins[c]);
+    keyScan.rowEnable = gpioPin(REN_PIN);
+    for (int bit = 0; bit < inputSize; bit++) {
+        keyScan.integrator[bit] = (keyScan.debounced >> bit & 1) ? KEYSCAN_DEBOUNCE : 0;
+    }
+
+    keyScan.row = 0;
+    keyScanSelectRow(0);
+    HardwareTimer* scanTimer = new HardwareTimer(timerInstance);
+    scanTimer->setOverflow(KEYSCAN_RATE, HERTZ_FORMAT);
+    scanTimer->attachInterrupt(keyScanISR);
+    scanTimer->resume();
+}
+
+#endif
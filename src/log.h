@@ -0,0 +1,117 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <Arduino.h>
+#include <STM32FreeRTOS.h>
+#include "logformat.h"
+#include "mpscring.h"
+#include "profile.h"
+#include "keyscan.h"
+#include "noteevents.h"
+
+// -------------------- Deferred Binary Log --------------------
+// Real-time tasks don't print. logEvent() stores a format ID, a timestamp and
+// up to three integer arguments in a lock-free ring, which takes well under a
+// microsecond and never blocks. logTask drains the ring at the lowest
+// priority and writes each record to the UART as a short binary frame.
+// tools/logdecode.cpp turns the frames back into text. A full ring drops the
+// record, and the drain reports how many were lost.
+const uint32_t LOG_RING = 64;
+const uint32_t LOG_BAUD = 115200;
+const TickType_t LOG_DRAIN_INTERVAL = 10;       // ms
+
+struct LogRecord {
+    uint32_t time;                              // micros()
+    uint8_t format;                             // LogFormat
+    uint8_t argCount;
+    int32_t args[LOG_MAX_ARGS];
+};
+
+MpscRing<LogRecord, LOG_RING> logRing;
+
+// Any task or ISR
+template <typename... Args>
+inline bool logEvent(LogFormat format, Args... args) {
+    static_assert(sizeof...(Args) <= LOG_MAX_ARGS, "too many log arguments");
+    LogRecord record = {micros(), (uint8_t)format, (uint8_t)sizeof...(Args), {(int32_t)args...}};
+    return logRing.post(record);
+}
+
+void logWriteFrame(const LogRecord& record) {
+    uint8_t frame[LOG_FRAME_BYTES];
+    frame[0] = LOG_FRAME_SYNC;
+    frame[1] = record.format;
+    frame[2] = record.argCount;
+    memcpy(&frame[3], &record.time, 4);         // Both ends are little-endian
+    memcpy(&frame[LOG_HEADER_BYTES], record.args, 4 * record.argCount);
+    Serial.write(frame, LOG_HEADER_BYTES + 4 * record.argCount);
+}
+
+// Loss counters of the lock-free rings and queues, reported by logTask as
+// they grow
+struct LogDropCounter {
+    const uint32_t* count;
+    LogFormat format;
+    uint32_t reported;
+};
+
+LogDropCounter logDropCounters[] = {
+    {&logRing.overflows, LOG_DROPPED, 0},
+    {&keyEventOverflows, LOG_KEY_EVENTS_DROPPED, 0},
+    {&noteEventRing.overflows, LOG_NOTE_EVENTS_DROPPED, 0},
+};
+
+// After the profiler table on 'p': depth and losses of the lock-free rings
+void logRingDump() {
+    struct RingInfo {
+        const char* name;
+        uint32_t size, highWater, overflows;
+    };
+    const RingInfo rings[] = {
+        {"log", LOG_RING, __atomic_load_n(&logRing.highWater, __ATOMIC_RELAXED),
+         __atomic_load_n(&logRing.overflows, __ATOMIC_RELAXED)},
+        {"noteEvents", NOTE_EVENT_RING, __atomic_load_n(&noteEventRing.highWater, __ATOMIC_RELAXED),
+         __atomic_load_n(&noteEventRing.overflows, __ATOMIC_RELAXED)},
+    };
+
+    Serial.println();
+    Serial.println("| Ring | Size | High water | Dropped |");
+    Serial.println("|------|------|------------|---------|");
+    char line[64];
+    for (const RingInfo& ring : rings) {
+        snprintf(line, sizeof(line), "| %s | %lu | %lu | %lu |", ring.name, (unsigned long)ring.size,
+                 (unsigned long)ring.highWater, (unsigned long)ring.overflows);
+        Serial.println(line);
+    }
+}
+
+// Lowest priority; the only task writing to Serial. Also takes the profiler
+// commands: 'p' prints the table, 'r' restarts it.
+void logTask(void* pvParameters) {
+    while (1) {
+        vTaskDelay(LOG_DRAIN_INTERVAL / portTICK_PERIOD_MS);
+        profileBegin(PROF_LOG);
+        profileWindowUpdate();
+        LogRecord record;
+        while (logRing.take(record)) logWriteFrame(record);
+
+        for (LogDropCounter& counter : logDropCounters) {
+            uint32_t dropped = __atomic_load_n(counter.count, __ATOMIC_RELAXED);
+            if (dropped == counter.reported) continue;
+            LogRecord report = {micros(), (uint8_t)counter.format, 1, {(int32_t)(dropped - counter.reported)}};
+            logWriteFrame(report);
+            counter.reported = dropped;
+        }
+        profileEnd(PROF_LOG);
+
+        while (Serial.available()) {
+            int command = Serial.read();
+            if (command == 'p') {
+                profileDump();
+                logRingDump();
+            } else if (command == 'r') profileReset();
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef LOGFORMAT_H
+#define LOGFORMAT_H
+
+#include <stdint.h>
+
+// -------------------- Log Record Formats --------------------
+// Shared by the firmware (src/log.h) and the host decoder
+// (tools/logdecode.cpp), so the two can't drift. A record is sent as one
+// frame:
+//
+//   LOG_FRAME_SYNC, format, argCount, time (us, 4 bytes LE), args (4 bytes LE each)
+//
+// Arguments are int32; the format strings are printf formats taking them in
+// order. Add new formats at the end of the enum and the table.
+enum LogFormat : uint8_t {
+    LOG_DROPPED,
+    LOG_SCAN_KEYS_STARTED,
+    LOG_DECODE_STARTED,
+    LOG_CAN_TX_STARTED,
+    LOG_TUNE_SENT,
+    LOG_POSITION_REQUEST,
+    LOG_TUNE_RECEIVED,
+    LOG_BOARD_JOIN,
+    LOG_POSITION_UPDATE,
+    LOG_CAN_TX,
+    LOG_KEY_EVENTS_DROPPED,
+    LOG_NOTE_EVENTS_DROPPED,
+    LOG_FORMATS
+};
+
+const char* const logFormats[LOG_FORMATS] = {
+    "Log: %d records dropped",
+    "scanKeysTask started!",
+    "decodeTask started!",
+    "CAN_TX_Task started!",
+    "Tune updated by main board: %d",
+    "Triggering position update request...",
+    "Update tune: %d",
+    "New board request received from UID %d",
+    "Update posId: %d",
+    "TX: %c %d %d",
+    "Key scan: %d key events dropped",
+    "Note bus: %d note events dropped",
+};
+
+const uint8_t LOG_FRAME_SYNC = 0xA5;            // Not printable, so plain text passes through
+const int LOG_MAX_ARGS = 3;
+const int LOG_HEADER_BYTES = 7;
+const int LOG_FRAME_BYTES = LOG_HEADER_BYTES + 4 * LOG_MAX_ARGS;
+
+#endif
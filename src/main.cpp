@@ -8,10 +8,26 @@
 #include "waves.h"
 #include "ui.h"
 #include "effect.h"
+#include "output.h"
+#include "eq.h"
+#include "fm.h"
+#include "pluck.h"
+#include "sampler.h"
+#include "morph.h"
+#include "unison.h"
+#include "drums.h"
+#include "additive.h"
+#include "tuning.h"
+#include "modmatrix.h"
+#include "keyscan.h"
+#include "joystick.h"
+#include "noteevents.h"
+#include "uisnapshot.h"
+#include "log.h"
 
 // -------------------- Module: Sample Buffer Writer --------------------
 // Write output sample into active sample buffer
-void writeToSampleBuffer(uint32_t Vout, uint32_t writeCtr){
+void writeToSampleBuffer(sample_t Vout, uint32_t writeCtr){
     if (writeBuffer1){
         sampleBuffer1[writeCtr] = Vout;
     } else {
@@ -33,6 +49,7 @@ void send_handshake_signal(int stateW, int stateE){
 }
 
 void sampleISR() {
+  profileBegin(PROF_SAMPLE_ISR);
   static uint32_t readCtr = 0;
   static uint32_t metronomeCounter = 0;
 
@@ -49,7 +66,7 @@ void sampleISR() {
       }
 
       if (metronomeSpeed != 8 && metronomeCounter >= metronomeTime[7 - metronomeSpeed] && metronomeOn) {
-          analogWrite(OUTR_PIN, 255);
+          analogWrite(OUTR_PIN, OUTPUT_MAX);
           metronomeCounter = 0;
       } else {
           analogWrite(OUTR_PIN, writeBuffer1 ? sampleBuffer0[readCtr++] : sampleBuffer1[readCtr++]);
@@ -63,16 +80,21 @@ void sampleISR() {
           readCtr++;
       }
   }
+  profileEnd(PROF_SAMPLE_ISR);
 }
 
 void CAN_RX_ISR (void) {
+	profileBegin(PROF_CAN_RX_ISR);
 	uint8_t RX_Message_ISR[8];
 	CAN_RX(ID, RX_Message_ISR);
 	xQueueSendFromISR(msgInQ, RX_Message_ISR, NULL);
+	profileEnd(PROF_CAN_RX_ISR);
 }
 
 void CAN_TX_ISR (void) {
+	profileBegin(PROF_CAN_TX_ISR);
 	xSemaphoreGiveFromISR(CAN_TX_Semaphore, NULL);
+	profileEnd(PROF_CAN_TX_ISR);
 }
 
 
@@ -82,9 +104,9 @@ int auto_detect_init() {
   uint8_t detext_TX_Message[8] = {0};   // Message to send via CAN
   uint32_t detect_CAN_ID = 0x123;       // Common CAN ID for detection
 
-  std::bitset<28> inputs;
-  std::bitset<1> WestDetect;
-  std::bitset<1> EastDetect;
+  uint32_t inputs;
+  bool WestDetect;
+  bool EastDetect;
 
   // Display detection screen
   u8g2.clearBuffer();
@@ -101,12 +123,12 @@ int auto_detect_init() {
 
   // Read handshake detection pins
   inputs = readInputs();
-  WestDetect = extractBits<28, 1>(inputs, 23, 1);
-  EastDetect = extractBits<28, 1>(inputs, 27, 1);
+  WestDetect = INPUT_WEST_DETECT(inputs);
+  EastDetect = INPUT_EAST_DETECT(inputs);
   delay(2000);  // Allow time for signal propagation
 
   // If there is no board on the west → not the main board
-  if (!WestDetect[0]) {
+  if (!WestDetect) {
       Serial.println("West board detected (not main)");
 
       // Wait for confirmation message from main board
@@ -129,9 +151,9 @@ int auto_detect_init() {
       // Wait for handshake signal to be updated again
       do {
           inputs = readInputs();
-          WestDetect = extractBits<28, 1>(inputs, 23, 1);
+          WestDetect = INPUT_WEST_DETECT(inputs);
           delay(10);
-      } while (WestDetect[0]);
+      } while (WestDetect);
 
       Serial.println("Updated West Detect confirmed.");
       delay(200);
@@ -191,172 +213,133 @@ int auto_detect_init() {
 }
 
 void scanKeysTask(void *pvParameters) {
-  Serial.println("scanKeysTask started!");
+  logEvent(LOG_SCAN_KEYS_STARTED);
 
   const TickType_t scanInterval = 20 / portTICK_PERIOD_MS;
   TickType_t lastWakeTime = xTaskGetTickCount();
+  uint8_t keyMessage[8] = {0};
 
-  std::bitset<12> currentKeys;
-  std::bitset<12> previousKeys("111111111111");
-
-  std::bitset<8> knobStatesCurrent, knobStatesPrevious("00000000");
-  std::bitset<4> knobClicksCurrent, knobClicksPrevious("0000");
-
-  std::bitset<1> joystickStateCurrent("0"), joystickStatePrevious("0");
-  std::bitset<1> westDetectPrevious, eastDetectPrevious;
+  uint32_t previousInputs = 0;
 
   int tunePrevious = 0;
   int tuneCurrent = 0;
+  uint32_t tuningVersionSent = 0;
 
   while (1) {
-      vTaskDelayUntil(&lastWakeTime, scanInterval);
+      // Key events from the scanner are handled as they arrive; the rest
+      // (knobs, menu, board sync) keeps the 20 ms tick
+      TickType_t elapsed = xTaskGetTickCount() - lastWakeTime;
+      TickType_t wait = (elapsed < scanInterval) ? scanInterval - elapsed : 0;
+      KeyEvent event;
+      if (xQueueReceive(keyEventQ, &event, wait) == pdTRUE) {
+          profileBegin(PROF_KEY_EVENTS);
+          uint32_t inputs = __atomic_load_n(&keyScanState, __ATOMIC_ACQUIRE);
+          int tune = __atomic_load_n(&settings.tune, __ATOMIC_RELAXED);
+          // Main board operation: local sound play
+          if (INPUT_WEST_DETECT(inputs) && INPUT_EAST_DETECT(inputs)) {
+              noteEventPost(event.pressed ? NOTE_EVENT_ON : NOTE_EVENT_OFF, (tune - 1) * 12 + event.key, 0);
+          }
+          // Otherwise, in relay mode: forward the change via CAN
+          else {
+              keyMessage[0] = event.pressed ? 'P' : 'R';
+              keyMessage[1] = event.key;
+              keyMessage[2] = tune;
+              keyMessage[3] = __atomic_load_n(&sysState.posId, __ATOMIC_RELAXED);
+              xQueueSend(msgOutQ, keyMessage, portMAX_DELAY);
+          }
+          profileEnd(PROF_KEY_EVENTS);
+          continue;
+      }
+      lastWakeTime += scanInterval;
+      profileBegin(PROF_SCAN_KEYS);
 
       // Lock shared state
       xSemaphoreTake(sysState.mutex, portMAX_DELAY);
-      xSemaphoreTake(notes.mutex, portMAX_DELAY);
       xSemaphoreTake(settings.mutex, portMAX_DELAY);
 
-      // Read all hardware inputs
-      sysState.inputs = readInputs();
-
-      currentKeys = extractBits<inputSize, 12>(sysState.inputs, 0, 12);
-      sysState.WestDetect = extractBits<28, 1>(sysState.inputs, 23, 1);
-      sysState.EastDetect = extractBits<28, 1>(sysState.inputs, 27, 1);
+      // Latest debounced inputs from the key scanner
+      uint32_t inputs = __atomic_load_n(&keyScanState, __ATOMIC_ACQUIRE);
+      uint32_t changed = inputs ^ previousInputs;
+      __atomic_store_n(&sysState.inputs, inputs, __ATOMIC_RELAXED);
 
-      knobStatesCurrent = extractBits<inputSize, 8>(sysState.inputs, 12, 8);
-      knobClicksCurrent = extractBits<inputSize, 4>(sysState.inputs, 20, 2).to_ulong() << 2 |
-                          extractBits<inputSize, 4>(sysState.inputs, 24, 2).to_ulong();
-
-      joystickStateCurrent = extractBits<inputSize, 1>(sysState.inputs, 22, 1).to_ulong();
+      sysState.WestDetect = INPUT_WEST_DETECT(inputs);
+      sysState.EastDetect = INPUT_EAST_DETECT(inputs);
 
       // Toggle joystick flag if state changed and pressed
-      if (joystickStateCurrent != joystickStatePrevious && joystickStateCurrent == 0) {
+      if ((changed & INPUT_JOYSTICK_PRESS.mask()) && !INPUT_JOYSTICK_PRESS(inputs)) {
           sysState.joystickState = !sysState.joystickState;
       }
 
       // Update knob values and click states
-      updateKnob(sysState.knobValues, knobStatesPrevious, knobStatesCurrent,
-                 knobClicksPrevious, knobClicksCurrent);
+      updateKnob(sysState.knobValues, previousInputs, inputs);
 
       // Update menu configuration
-      update_menu_settings(sysState.currentMenu, tuneCurrent);
+      update_menu_settings((MenuPage)__atomic_load_n(&sysState.currentMenu, __ATOMIC_RELAXED), tuneCurrent);
 
       // Sync tune if changed and in main board
-      if (tuneCurrent != tunePrevious && sysState.posId == 0 && !sysState.EastDetect[0]) {
-          Serial.println("Tune updated by main board.");
+      if (tuneCurrent != tunePrevious && sysState.posId == 0 && !sysState.EastDetect) {
+          logEvent(LOG_TUNE_SENT, tuneCurrent);
           __atomic_store_n(&settings.tune, tuneCurrent, __ATOMIC_RELAXED);
           TX_Message[0] = 'T';
           TX_Message[1] = tuneCurrent;
           xQueueSend(msgOutQ, const_cast<uint8_t *>(TX_Message), portMAX_DELAY);
       }
 
+      // Sync tuning the same way, so every board resolves keys alike
+      uint32_t tuningVersion = __atomic_load_n(&paramVersions[PARAM_TUNING], __ATOMIC_RELAXED);
+      if (tuningVersion != tuningVersionSent && sysState.posId == 0 && !sysState.EastDetect) {
+          tuningMessage(TX_Message);
+          xQueueSend(msgOutQ, const_cast<uint8_t *>(TX_Message), portMAX_DELAY);
+          tuningVersionSent = tuningVersion;
+      }
+
       // Position update trigger if WestDetect changed
-      if (eastDetectPrevious[0] && westDetectPrevious[0] && (!sysState.WestDetect[0])) {
-          Serial.println("Triggering position update request...");
+      if (INPUT_EAST_DETECT(previousInputs) && INPUT_WEST_DETECT(previousInputs) && !sysState.WestDetect) {
+          logEvent(LOG_POSITION_REQUEST);
           delay(100);
           TX_Message[0] = 'N';
           TX_Message[1] = sysState.local_boardId;
           xQueueSend(msgOutQ, const_cast<uint8_t *>(TX_Message), portMAX_DELAY);
       }
 
-      // Main board operation: local sound play
-      if (sysState.WestDetect[0] && sysState.EastDetect[0]) {
+      // Main board operation: position 0
+      if (sysState.WestDetect && sysState.EastDetect) {
           sysState.posId = 0;
-          int tune = __atomic_load_n(&settings.tune, __ATOMIC_RELAXED);
-          for (int i = 0; i < 12; ++i) {
-              if (currentKeys.to_ulong() != 0xFFF) {
-                  notes.notes[(tune - 1) * 12 + i].active = !currentKeys[i];
-              } else {
-                  notes.notes[(tune - 1) * 12 + i].active = false;
-              }
-          }
-      }
-
-      // Otherwise, in relay mode: forward note state changes via CAN
-      else {
-          for (int i = 0; i < 12; ++i) {
-              if (currentKeys[i] != previousKeys[i]) {
-                  TX_Message[0] = currentKeys[i] ? 'R' : 'P';
-                  TX_Message[1] = i;
-                  TX_Message[2] = settings.tune;
-                  TX_Message[3] = sysState.posId;
-                  xQueueSend(msgOutQ, const_cast<uint8_t *>(TX_Message), portMAX_DELAY);
-              }
-          }
       }
 
       // Store previous values for next loop
       tunePrevious = tuneCurrent;
-      previousKeys = currentKeys;
-      knobStatesPrevious = knobStatesCurrent;
-      knobClicksPrevious = knobClicksCurrent;
-      joystickStatePrevious = joystickStateCurrent;
-      westDetectPrevious = sysState.WestDetect;
-      eastDetectPrevious = sysState.EastDetect;
-
-      // Release all mutexes
+      previousInputs = inputs;
+
+      // Hand the backend and the display the new state, then release all mutexes
+      settingsPublish();
+      uiPublish();
       xSemaphoreGive(sysState.mutex);
-      xSemaphoreGive(notes.mutex);
       xSemaphoreGive(settings.mutex);
+      profileEnd(PROF_SCAN_KEYS);
   }
 }
 
 // -------------------- Joystick Scanning Task --------------------
 void scanJoystickTask(void *pvParameters) {
-  const TickType_t xFrequency = 100 / portTICK_PERIOD_MS;
+  // Polled fast for pitch bend and menu gestures; the ADC runs on its own
+  const TickType_t xFrequency = 5 / portTICK_PERIOD_MS;
+  joystickCalibrate();
   TickType_t xLastWakeTime = xTaskGetTickCount();
 
-  const int origin = 490;              // Joystick center position
-  const int deadZone = 150;            // Threshold range around center to ignore small drift
-  int joystickX = 0, joystickY = 0;
-
-  std::string previousMovement = "origin";
-  std::string currentMovement;
-
   while (1) {
       vTaskDelayUntil(&xLastWakeTime, xFrequency);
+      profileBegin(PROF_JOYSTICK);
+      joystickPoll();
 
-      joystickX = analogRead(JOYX_PIN);
-      joystickY = analogRead(JOYY_PIN);
-
-      // Determine joystick movement direction
-      if (abs(joystickX - origin) <= deadZone && abs(joystickY - origin) <= deadZone) {
-          currentMovement = "origin";
-      } else if (joystickX - origin > deadZone) {
-          currentMovement = "left";
-      } else if (joystickX - origin < -deadZone) {
-          currentMovement = "right";
-      } else if (joystickY - origin > deadZone) {
-          currentMovement = "down";
-
-          // Scroll menu down
-          if (selected_option < total_menu_items - 1) {
-              selected_option++;
-              if ((selected_option * ITEM_SPACING) >= (menu_offset + PAGE_HEIGHT)) {
-                  menu_offset += ITEM_SPACING;
-              }
-          }
-
-      } else if (joystickY - origin < -deadZone) {
-          currentMovement = "up";
-
-          // Scroll menu up
-          if (selected_option > 0) {
-              selected_option--;
-              if ((selected_option * ITEM_SPACING) < menu_offset) {
-                  menu_offset = std::max(0, menu_offset - ITEM_SPACING);
-              }
-          }
-      }
-
-      // Confirm movement only on release to center
-      if (currentMovement != previousMovement && currentMovement == "origin") {
-          movement = previousMovement;
+      // Play mode: X bends (right is up), Y either way sets vibrato depth
+      if (__atomic_load_n(&sysState.knobValues[0].clickState, __ATOMIC_RELAXED)) {
+          bendSetInputs(0, 0);
       } else {
-          movement = "origin";
+          bendSetInputs(__atomic_load_n(&joystickX, __ATOMIC_RELAXED) * BEND_INPUT_SCALE / JOY_AXIS_SCALE,
+                        abs(__atomic_load_n(&joystickY, __ATOMIC_RELAXED)) * BEND_INPUT_SCALE / JOY_AXIS_SCALE);
       }
-
-      previousMovement = currentMovement;
+      profileEnd(PROF_JOYSTICK);
   }
 }
 
@@ -364,21 +347,24 @@ void scanJoystickTask(void *pvParameters) {
 void displayUpdateTask(void * pvParameters) {
     const TickType_t xFrequency2 = 100/portTICK_PERIOD_MS;
     TickType_t xLastWakeTime2 = xTaskGetTickCount();
-    static uint32_t count = 0;
     int posX = 0;
     int posY = 0;
     int index = 0;
     int stay_time = 2000;
     int counter = 0;
     int pressedKeyH = 20;
-    std::bitset<2> previous_knob1("00");
-    std::bitset<2> previous_knob2("00");
-    std::bitset<2> previous_knob3("00");
+    // Knobs 1-3 pop their value up on the home page when turned
+    const uint32_t valueKnobs = inputKnob(1).mask() | inputKnob(2).mask() | inputKnob(3).mask();
+    uint32_t previousInputs = 0;
     while (1) {
       vTaskDelayUntil( &xLastWakeTime2, xFrequency2);
+      profileBegin(PROF_DISPLAY);
+      JoystickGesture gesture = joystickTakeGesture();
+      // Published by the input tasks; drawing needs no lock
+      const UiSnapshot& ui = uiTake();
       u8g2.clearBuffer();
       
-      if (sysState.posId != 0){
+      if (ui.posId != 0){
         u8g2.setCursor(30, 15);
         u8g2.setFont(u8g2_font_ncenB08_tr);
         u8g2.print("Slave");
@@ -389,233 +375,262 @@ void displayUpdateTask(void * pvParameters) {
         if (counter != 0){
           counter --;
         }
-        xSemaphoreTake(sysState.mutex, portMAX_DELAY);
-        xSemaphoreTake(settings.mutex, portMAX_DELAY);
-  
-        if(sysState.knobValues[0].clickState){
+        if(ui.menuOpen){
           u8g2.setFont(u8g2_font_6x10_tr);
-          if (movement == "down"){
-            index += 3;
-          }
-          else if (movement == "up"){
-            index -= 3;
-          }
-          else if (movement == "right"){
-            index += 1;
-          }
-          else if (movement == "left"){
-            index -= 1;
-          }
-          index = constrain(index, 0, 6);
-  
-          if ((index * ITEM_SPACING) >= (menu_offset + PAGE_HEIGHT)) {
-              menu_offset += ITEM_SPACING;
-          } else if ((index * ITEM_SPACING) < menu_offset) {
-              menu_offset -= ITEM_SPACING;
+          switch (gesture) {
+            case JOY_DOWN:  index += 3; break;
+            case JOY_UP:    index -= 3; break;
+            case JOY_RIGHT: index += 1; break;
+            case JOY_LEFT:  index -= 1; break;
+            default: break;
           }
+          index = constrain(index, 0, total_menu_items - 1);
+          menu_offset = menuScroll(menu_offset, index);
   
-          for (int i = 0; i < 7; i++) {
-              int x_pos, y_pos;
-              if (i < 3) {  // 第一行
-                  x_pos = 10 + 35 * i;
-                  y_pos = 14;
-              } 
-              else if (i < 6) {  // 第二行
-                  x_pos = 10 + 35 * (i - 3);
-                  y_pos = 25;
-              } 
-              else {  // 第三行（只有一个 "Effect" 选项）
-                  x_pos = 10 + 35;  // 让 Effect 置于中间
-                  y_pos = 36;
-              }
-  
-              if (index == 6) {  
-                  if (menu_offset < ITEM_SPACING * 2) {
-                      menu_offset += 2;  // **缓慢滑动**
-                  }
-              } else if (index != 6) {
-                  menu_offset = 0;  // **缓慢回到默认位置**
-              }
-              int final_y_pos = y_pos - menu_offset;
+          for (int i = 0; i < total_menu_items; i++) {
+              // 每行三个选项
+              int x_pos = 10 + 35 * (i % MENU_COLUMNS);
+              int final_y_pos = menuItemY(i, menu_offset);
   
               // **如果在可见区域，才绘制**
-              if (final_y_pos >= 10 && final_y_pos < PAGE_HEIGHT + 10) {
+              if (menuItemVisible(final_y_pos)) {
                   if (index == i) {
                       // Draw a solid (filled) select box
                       u8g2.drawBox(x_pos - 3, final_y_pos - 9, 32, 12);
                       // Invert text color for the selected item
                       u8g2.setDrawColor(0);
                       u8g2.setCursor(x_pos, final_y_pos);
-                      u8g2.print(menu_first_level[i].c_str());
+                      u8g2.print(menuPages[menuItemPage(i)].label);
                       // Reset to default draw color
                       u8g2.setDrawColor(1);
                   } else {
                       u8g2.setCursor(x_pos, final_y_pos);
-                      u8g2.print(menu_first_level[i].c_str());
+                      u8g2.print(menuPages[menuItemPage(i)].label);
                   }
               }
           }
-          if (sysState.joystickState){
-            menu(index, settings);
+          // The knobs edit whatever is on screen
+          __atomic_store_n(&sysState.currentMenu, ui.pageOpen ? menuItemPage(index) : PAGE_GRID, __ATOMIC_RELAXED);
+          if (ui.pageOpen){
+            menu(menuItemPage(index), ui.values);
           }
         }
         else{
-          sysState.currentMenu = "Main";
+          __atomic_store_n(&sysState.currentMenu, PAGE_HOME, __ATOMIC_RELAXED);
           u8g2.setCursor(15, 10);
           u8g2.setFont(u8g2_font_ncenB08_tr);
           u8g2.print("LUGUAN Keyboard");
           u8g2.setFont(u8g2_font_5x8_tr);
           for (int i = 0; i < 4; i++){
             u8g2.drawFrame(8+30*i, 20, 25, 20);
-            if (i !=0 && 
-              (extractBits<inputSize, 2>(sysState.inputs, 12, 2) != previous_knob3 ||
-                extractBits<inputSize, 2>(sysState.inputs, 14, 2) != previous_knob2 ||
-                extractBits<inputSize, 2>(sysState.inputs, 16, 2) != previous_knob1)){
+            if (i != 0 && ((ui.inputs ^ previousInputs) & valueKnobs)) {
               counter = stay_time/100;
             }
             if (counter != 0  && i ==3){
-              u8g2.drawStr(10+30*i, 29, std::to_string(settings.volume).c_str());
+              drawNumber(10+30*i, 29, ui.values.volume);
             }
             else if (counter != 0 && i ==2 ){
-              u8g2.drawStr(10+30*i, 29, std::to_string(settings.tune).c_str());
+              drawNumber(10+30*i, 29, ui.values.tune);
             }
             else if (counter != 0 && i ==1 ){
-              u8g2.drawStr(10+30*i, 29, waveNames[settings.waveIndex].c_str());
+              u8g2.drawStr(10+30*i, 29, waveNames[ui.values.waveIndex]);
             }
             else{
-              u8g2.drawStr(10+30*i, 29, bottomBar_menu[i].c_str());
+              u8g2.drawStr(10+30*i, 29, bottomBar_menu[i]);
             }
           }
         }
-        previous_knob1 = extractBits<inputSize, 2>(sysState.inputs, 16, 2);
-        previous_knob2 = extractBits<inputSize, 2>(sysState.inputs, 14, 2);
-        previous_knob3 = extractBits<inputSize, 2>(sysState.inputs, 12, 2);
-        xSemaphoreGive(sysState.mutex);
-        xSemaphoreGive(settings.mutex);
+        previousInputs = ui.inputs;
       }
   
       u8g2.setFont(u8g2_font_5x8_tr);
       //display pressed keys
-      std::vector<std::string> pressedKeys;
+      uint32_t keys = INPUT_KEYS(ui.inputs);
+      int pressedCount = 0;
       for (int i = 0; i < 12; i++){
-        if (sysState.inputs[i] == 0){
-          pressedKeys.push_back(noteNames[i]);
+        if (!(keys >> i & 1)){
+          u8g2.drawStr(10 + 10*pressedCount++, pressedKeyH, noteNames[i]);
         }
       }
-      for (int i = 0; i < pressedKeys.size(); i++){
-        u8g2.setCursor(10+ 10*i, pressedKeyH);
-        u8g2.print(pressedKeys[i].c_str());
-      }
   
       u8g2.sendBuffer();
       digitalToggle(LED_BUILTIN);
+      profileEnd(PROF_DISPLAY);
     }
   }
   
 
+// -------------------- Module: Voice Mixer --------------------
+// Table for each wave knob version; the sawtooth (8) is computed, so null
+float* versionTable(int version) {
+  switch (version) {
+      case 7:  return sineTable;
+      case 6:  return squareTable;       // Square
+      case 5:  return triangleTable;
+      case 4:  return pianoTable;
+      case 3:  return saxophoneTable;
+      case 2:  return bellTable;
+      case 1:  return squareTable;       // Alarm
+      case 8 - WAVE_MORPH: return morphTable;  // Morph (blended once per block)
+      case 8:  return nullptr;           // Sawtooth
+      default: return dongTable;         // Random
+  }
+}
+
+// Sum one sample of every active note; returns the number of active notes
+int mixActiveNotes(int vol_knob_value, int version_knob_value, float* mix) {
+  int activeKeyCount = 0;
+  float floatAmp = 0.0f;
+  float* table = versionTable(version_knob_value);
+
+  for (int i = 0; i < 96; ++i) {
+      bool isActive = __atomic_load_n(&notes.notes[i].active, __ATOMIC_RELAXED);
+      if (!isActive) continue;
+      activeKeyCount++;
+
+      // Waveform generation based on knob selection
+      float amp = table ? getSample(bentPhases[i], &notes.notes[i].floatPhaseAcc, table)
+                        : calcSawtoothAmp(&notes.notes[i].floatPhaseAcc, vol_knob_value, i);
+      if (version_knob_value == 1) {  // Alarm
+          floatAmp += calcHornVout(amp, vol_knob_value, i);
+      }
+
+      floatAmp += addEffects(amp, vol_knob_value, i);
+  }
+
+  *mix = (activeKeyCount > 0) ? floatAmp / activeKeyCount : 0.0f;
+  return activeKeyCount;
+}
+
 // -------------------- Module: Background Audio Calculation Task --------------------
 // Background task for audio sample synthesis and processing
 void backgroundCalcTask(void *pvParameters) {
   static float prevfloatAmp = 0;
+  static float effectBlock[EFFECT_BLOCK_SIZE];
+  static int previousWaveIndex = -1;
 
   while (1) {
       // Wait for buffer availability
       xSemaphoreTake(sampleBufferSemaphore, portMAX_DELAY);
+      profileBegin(PROF_BACKEND);
       uint32_t writeCtr = 0;
 
+      // One consistent set of settings for the whole buffer
+      settingsSnapshot();
+
+      // Control-rate update: coefficients ramp across this buffer
+      updateEffectParams(SAMPLE_BUFFER_SIZE / 2);
+      updateTuningParams();
+      updateBendParams(SAMPLE_BUFFER_SIZE / 2);
+      updateLPFParams(SAMPLE_BUFFER_SIZE / 2);
+      updateEQParams();
+
       while (writeCtr < SAMPLE_BUFFER_SIZE / 2) {
-          int vol_knob_value = settings.volume;
-          int version_knob_value = 8 - settings.waveIndex;
+          int vol_knob_value = backendSettings.volume;
+          int waveIndex = backendSettings.waveIndex;
+          int version_knob_value = 8 - waveIndex;
+          int blockLength = std::min<int>(EFFECT_BLOCK_SIZE, SAMPLE_BUFFER_SIZE / 2 - writeCtr);
+
+          // Engines keep per-voice state, so start clean when switching
+          if (waveIndex != previousWaveIndex) {
+              voicePoolReset();
+              previousWaveIndex = waveIndex;
+          }
+
+          noteEventsDrain();
+          modulationBlock(blockLength);
+          pitchBendBlock(blockLength, modValue(MOD_DEST_PITCH));
+          if (modActive(MOD_DEST_CUTOFF)) modulateLPF(blockLength, modValue(MOD_DEST_CUTOFF));
 
           bool hasActiveKey = false;
-          int activeKeyCount = 0;
-          float floatAmp = 0.0f;
-
-          for (int i = 0; i < 96; ++i) {
-              if (writeCtr >= SAMPLE_BUFFER_SIZE / 2) break;
-
-              bool isActive = __atomic_load_n(&notes.notes[i].active, __ATOMIC_RELAXED);
-              if (isActive) {
-                  hasActiveKey = true;
-                  activeKeyCount++;
-
-                  float amp = 0.0f;
-
-                  // Waveform generation based on knob selection
-                  switch (version_knob_value) {
-                      case 8:  // Sawtooth
-                          amp = calcSawtoothAmp(&notes.notes[i].floatPhaseAcc, vol_knob_value, i);
-                          break;
-                      case 7:  // Sine
-                          amp = getSample(notePhases[i], &notes.notes[i].floatPhaseAcc, sineTable);
-                          break;
-                      case 6:  // Square
-                          amp = getSample(notePhases[i], &notes.notes[i].floatPhaseAcc, squareTable);
-                          break;
-                      case 5:  // Triangle
-                          amp = getSample(notePhases[i], &notes.notes[i].floatPhaseAcc, triangleTable);
-                          break;
-                      case 4:  // Piano
-                          amp = getSample(notePhases[i], &notes.notes[i].floatPhaseAcc, pianoTable);
-                          break;
-                      case 3:  // Saxophone
-                          amp = getSample(notePhases[i], &notes.notes[i].floatPhaseAcc, saxophoneTable);
-                          break;
-                      case 2:  // Bell
-                          amp = getSample(notePhases[i], &notes.notes[i].floatPhaseAcc, bellTable);
-                          break;
-                      case 1:  // Alarm
-                          amp = getSample(notePhases[i], &notes.notes[i].floatPhaseAcc, squareTable);
-                          floatAmp += calcHornVout(amp, vol_knob_value, i);
-                          break;
-                      default: // Random (dongTable)
-                          amp = getSample(notePhases[i], &notes.notes[i].floatPhaseAcc, dongTable);
-                          break;
+          switch (waveIndex) {
+              case WAVE_FM:
+                  hasActiveKey = fmRenderBlock(effectBlock, blockLength, vol_knob_value);
+                  break;
+              case WAVE_PLUCK:
+                  hasActiveKey = pluckRenderBlock(effectBlock, blockLength, vol_knob_value);
+                  break;
+              case WAVE_SAMPLE:
+                  hasActiveKey = samplerRenderBlock(effectBlock, blockLength, vol_knob_value);
+                  break;
+              case WAVE_ADDITIVE:
+                  hasActiveKey = additiveRenderBlock(effectBlock, blockLength, vol_knob_value) > 0;
+                  break;
+              case WAVE_MORPH:
+                  updateMorphTable(blockLength);
+                  // fall through
+              default:
+                  if (updateUnisonParams()) {
+                      hasActiveKey = unisonRenderBlock(effectBlock, blockLength, vol_knob_value,
+                                                       versionTable(version_knob_value), version_knob_value == 1) > 0;
+                      break;
+                  }
+                  for (int n = 0; n < blockLength; n++) {
+                      if (mixActiveNotes(vol_knob_value, version_knob_value, &effectBlock[n]) > 0) {
+                          hasActiveKey = true;
+                      }
                   }
+                  break;
+          }
 
-                  // Effect Chain
-                  floatAmp += addEffects(amp, vol_knob_value, i);
-                  floatAmp = applyEffects(floatAmp);
-              }
+          if (addDrums(effectBlock, blockLength, vol_knob_value)) {
+              hasActiveKey = true;
+          }
+          modApplyAmplitude(effectBlock, blockLength);
+
+          // Effect Chain (also runs on silence so tails can decay)
+          if (modActive(MOD_DEST_FX_MIX) && effectPipeline.count > 0) {
+              static float dryBlock[EFFECT_BLOCK_SIZE];
+              memcpy(dryBlock, effectBlock, blockLength * sizeof(float));
+              runEffectPipeline(effectBlock, blockLength);
+              modApplyEffectMix(effectBlock, dryBlock, blockLength);
+          } else {
+              runEffectPipeline(effectBlock, blockLength);
+          }
 
-              // When reaching last note, finalize this sample
-              if (i == 95 && activeKeyCount > 0) {
-                  floatAmp /= activeKeyCount;
-                //   floatAmp += addLFO(floatAmp, vol_knob_value);
-                  floatAmp = addLPF(floatAmp, &prevfloatAmp);
-                  uint32_t Vout = static_cast<uint32_t>(floatAmp);
-                  writeToSampleBuffer(Vout, writeCtr++);
+          // No keys and no effects → write silence
+          if (!hasActiveKey && effectPipeline.count == 0) {
+              eqReset();
+              for (int n = 0; n < blockLength; n++) {
+                  writeToSampleBuffer(0, writeCtr++);
               }
+              continue;
           }
 
-          // No keys active → write silence
-          if (!hasActiveKey && writeCtr < SAMPLE_BUFFER_SIZE / 2) {
-              writeToSampleBuffer(0, writeCtr++);
+          addLPF(effectBlock, blockLength, &prevfloatAmp);
+          eqBlock(effectBlock, blockLength);
+          for (int n = 0; n < blockLength; n++) {
+              writeToSampleBuffer(requantize(effectBlock[n]), writeCtr++);
           }
       }
 
+      profileEnd(PROF_BACKEND);
       vTaskDelay(1); // Yield to other tasks
   }
 }
 // -------------------- Task: Decode Received CAN Messages --------------------
 void decodeTask(void * pvParameters) {
-  Serial.println("decodeTask started!");
+  logEvent(LOG_DECODE_STARTED);
   while (1) {
       // Wait for incoming message
       xQueueReceive(msgInQ, RX_Message, portMAX_DELAY);
+      profileBegin(PROF_DECODE);
 
       xSemaphoreTake(sysState.mutex, portMAX_DELAY);
-      xSemaphoreTake(notes.mutex, portMAX_DELAY);
       xSemaphoreTake(settings.mutex, portMAX_DELAY);
 
       // ---------- Handle Note Press/Release for Main Board ----------
       if (sysState.posId == 0) {
-          if (RX_Message[0] == 'P') {
-              sysState.inputs[RX_Message[1]] = 0;
-              notes.notes[(RX_Message[2] - 1) * 12 + RX_Message[1]].active = true;
+          bool drumBoard = settings.drums.on && settings.drums.board != 0 && RX_Message[3] == settings.drums.board;
+          if (drumBoard) {
+              // Pads are one-shots, so only presses matter
+              if (RX_Message[0] == 'P') drumTrigger(drumKeyMap[RX_Message[1] % 12]);
+          } else if (RX_Message[0] == 'P') {
+              sysState.inputs &= ~(1u << RX_Message[1]);
+              noteEventPost(NOTE_EVENT_ON, (RX_Message[2] - 1) * 12 + RX_Message[1], RX_Message[3]);
           } else if (RX_Message[0] == 'R') {
-              sysState.inputs[RX_Message[1]] = 1;
-              notes.notes[(RX_Message[2] - 1) * 12 + RX_Message[1]].active = false;
+              sysState.inputs |= 1u << RX_Message[1];
+              noteEventPost(NOTE_EVENT_OFF, (RX_Message[2] - 1) * 12 + RX_Message[1], RX_Message[3]);
           }
       }
 
@@ -628,19 +643,28 @@ void decodeTask(void * pvParameters) {
 
       // ---------- Update Tune ----------
       if (RX_Message[0] == 'T') {
-          Serial.println("Update tune!");
           settings.tune = RX_Message[1] + sysState.posId;
           settings.tune = constrain(settings.tune, 0, 8);
-          Serial.println(settings.tune);
+          logEvent(LOG_TUNE_RECEIVED, settings.tune);
+      }
+
+      // ---------- Update Tuning ----------
+      if (RX_Message[0] == 'S' && sysState.posId != 0) {
+          tuningReceive(RX_Message);
       }
 
       // ---------- New Board Join Request ----------
       if (RX_Message[0] == 'N') {
-          Serial.println("New board request received!");
+          logEvent(LOG_BOARD_JOIN, RX_Message[1]);
           TX_Message[0] = 'U';
           TX_Message[1] = sysState.posId;
           TX_Message[2] = RX_Message[1];
           xQueueSend(msgOutQ, const_cast<uint8_t*>(TX_Message), portMAX_DELAY);
+          // The newcomer also needs the master's tuning
+          if (sysState.posId == 0) {
+              tuningMessage(TX_Message);
+              xQueueSend(msgOutQ, const_cast<uint8_t*>(TX_Message), portMAX_DELAY);
+          }
       }
 
       // ---------- Update Board ID Position ----------
@@ -648,36 +672,34 @@ void decodeTask(void * pvParameters) {
           if (RX_Message[1] >= sysState.posId) {
               sysState.posId = RX_Message[1] + 1;
               settings.tune = sysState.posId + 3;
-              Serial.print("Update posId: ");
-              Serial.println(sysState.posId);
+              logEvent(LOG_POSITION_UPDATE, sysState.posId);
           }
       }
 
-      xSemaphoreGive(notes.mutex);
+      settingsPublish();
+      uiPublish();
       xSemaphoreGive(sysState.mutex);
       xSemaphoreGive(settings.mutex);
+      profileEnd(PROF_DECODE);
   }
 }
 
 // -------------------- Task: CAN Message Transmit Handler --------------------
 void CAN_TX_Task(void * pvParameters) {
-  Serial.println("CAN_TX_Task started!");
+  logEvent(LOG_CAN_TX_STARTED);
   uint8_t msgOut[8];
 
   while (1) {
       // Wait for a message in TX queue
       xQueueReceive(msgOutQ, msgOut, portMAX_DELAY);
       xSemaphoreTake(CAN_TX_Semaphore, portMAX_DELAY);
+      profileBegin(PROF_CAN_TX);
 
-      // Print debug info
-      Serial.print("TX: ");
-      Serial.print((char)msgOut[0]);
-      Serial.print(msgOut[1]);
-      Serial.print(msgOut[2]);
-      Serial.println();
+      logEvent(LOG_CAN_TX, msgOut[0], msgOut[1], msgOut[2]);
 
       // Transmit CAN message
       CAN_TX(ID, msgOut);
+      profileEnd(PROF_CAN_TX);
   }
 }
 
@@ -689,17 +711,41 @@ void fillmsgQ() {
   }
 }
 
+// -------------------- Utility: Checked Task Creation --------------------
+// Every task gets a 256-word stack; a failure is reported rather than leaving
+// a null handle behind
+void createTask(TaskFunction_t task, const char* name, UBaseType_t priority, TaskHandle_t* handle) {
+  if (xTaskCreate(task, name, 256, NULL, priority, handle) != pdPASS) {
+      *handle = NULL;
+      Serial.print("Failed to create task: ");
+      Serial.println(name);
+  }
+}
+
 void setup() {
   // ---------- Initialize Internal Knob Default State ----------
   sysState.knobValues[2].current_knob_value = 4;
   sysState.knobValues[3].current_knob_value = 6;
 
+  // ---------- Cycle Counter for the Profiler, Before Any ISR ----------
+  profileInit();
+
   // ---------- Initialize Phase Lookup Table and Settings ----------
   generatePhaseLUT();
+  bendInit();
   set_pin_directions();
   set_notes();
+  noteEventsInit();
   init_settings();
   initEffects();
+  fmInit();
+  samplerInit();
+  drumsInit();
+  tuningInit();
+
+#if OUTPUT_BITS != 8
+  analogWriteResolution(OUTPUT_BITS);
+#endif
 
   // ---------- Initial Display Rendering ----------
   initial_display();
@@ -724,13 +770,24 @@ void setup() {
   CAN_Start();
 
   // ---------- Serial Communication Setup ----------
-  Serial.begin(9600);
+  Serial.begin(LOG_BAUD);
+  logRing.init();
   Serial.println("Serial port initialized");
 
+  // ---------- Joystick ADC + DMA ----------
+  if (!joystickStart()) Serial.println("Joystick ADC failed to start");
+
   // ---------- Auto-Detect Board Position ID ----------
   sysState.posId = auto_detect_init();
   delay(200);
   initial_display();
+  // The scanner drives REN and RA0-2 from here on, so nothing may bit-bang
+  // the output mux (setOutMuxBit) after this
+  keyScanStart(TIM2);
+
+  // ---------- Publish Start-Up Settings to the Backend and Display ----------
+  settingsPublish();
+  uiPublish();
 
 //   Serial.print("posId: ");
 //   Serial.println(sysState.posId);
@@ -740,65 +797,23 @@ void setup() {
 //   Serial.println(sysState.local_boardId);
 
   // ---------- Create System Tasks ----------
-  xTaskCreate(
-      backgroundCalcTask,
-      "BackCalc",
-      256,
-      NULL,
-      4,
-      &BackCalc_Handle
-  );
-
-  xTaskCreate(
-      scanKeysTask,
-      "scanKeys",
-      256,
-      NULL,
-      6,
-      &scanKeysHandle
-  );
-
-  xTaskCreate(
-      displayUpdateTask,
-      "displayUpdate",
-      256,
-      NULL,
-      2,
-      &displayUpdateHandle
-  );
-
-  xTaskCreate(
-      decodeTask,
-      "decode",
-      256,
-      NULL,
-      5,
-      &decodeTaskHandle
-  );
-
-  xTaskCreate(
-      scanJoystickTask,
-      "scanJoystick",
-      256,
-      NULL,
-      1,
-      &scanJoystick_Handle
-  );
-
-  xTaskCreate(
-      CAN_TX_Task,
-      "CAN_TX",
-      256,
-      NULL,
-      3,
-      &CAN_TX_Handle
-  );
+  createTask(backgroundCalcTask, "BackCalc", 4, &BackCalc_Handle);
+  createTask(scanKeysTask, "scanKeys", 6, &scanKeysHandle);
+  createTask(displayUpdateTask, "displayUpdate", 2, &displayUpdateHandle);
+  createTask(decodeTask, "decode", 5, &decodeTaskHandle);
+  createTask(scanJoystickTask, "scanJoystick", 3, &scanJoystick_Handle);
+  createTask(CAN_TX_Task, "CAN_TX", 3, &CAN_TX_Handle);
+  createTask(additiveTask, "additiveGen", 1, &additiveGen_Handle);
+  createTask(logTask, "log", tskIDLE_PRIORITY, &log_Handle);
 
   // ---------- Initialize Shared Resource Mutex ----------
-  notes.mutex     = xSemaphoreCreateMutex();
   sysState.mutex  = xSemaphoreCreateMutex();
   settings.mutex  = xSemaphoreCreateMutex();
 
+  // ---------- Delay Line From the SRAM Left Over ----------
+  // Last allocation before the scheduler, which only adds the idle task
+  initDelayBuffer();
+
   // ---------- Start RTOS Scheduler ----------
   vTaskStartScheduler();
 }
@@ -0,0 +1,146 @@
+#ifndef MODMATRIX_H
+#define MODMATRIX_H
+
+#include "pin.h"
+#include "params.h"
+#include <math.h>
+
+// -------------------- Modulation Matrix --------------------
+// Three LFOs (sine, triangle, sample & hold) and a key envelope, each routed
+// to one destination with a signed depth. Sources are evaluated once per
+// 64-sample block; destinations keep the previous block's value so per-sample
+// users (amplitude, effect mix) can ramp between the two, and the rest
+// (pitch, cutoff, morph) are applied where those modules already work per
+// block. A destination nothing is routed to costs nothing.
+enum ModSource { MOD_SRC_LFO1, MOD_SRC_LFO2, MOD_SRC_LFO3, MOD_SRC_ENV, MOD_SOURCES };
+enum ModDest { MOD_DEST_OFF, MOD_DEST_PITCH, MOD_DEST_CUTOFF, MOD_DEST_AMP, MOD_DEST_MORPH, MOD_DEST_FX_MIX, MOD_DESTS };
+enum LfoShape { LFO_SINE, LFO_TRIANGLE, LFO_SAMPLE_HOLD, LFO_SHAPES };
+
+static_assert(MOD_SOURCES == MOD_LFOS + 1, "one route per LFO plus the envelope");
+
+const char* const modSourceNames[MOD_SOURCES] = {"LFO1", "LFO2", "LFO3", "Env"};
+const char* const modDestNames[MOD_DESTS] = {"Off", "Pitch", "Cut", "Amp", "Morph", "FX"};
+const char* const lfoShapeNames[LFO_SHAPES] = {"Sin", "Tri", "S&H"};
+
+// Full-depth (10) swing per destination: semitones, octaves, gain, tables, wet
+const float MOD_DEPTH_SCALE[MOD_DESTS] = {0.0f, 0.2f, 0.2f, 0.1f, 0.4f, 0.1f};
+const float MOD_LFO_HZ_PER_STEP = 0.5f;
+const float MOD_ENV_DECAY_TIME = 0.4f;       // Seconds to fall to 1/e after a new key
+
+struct {
+    uint32_t lfoPhase[MOD_LFOS] = {0};
+    uint32_t lfoInc[MOD_LFOS] = {0};
+    int lfoShape[MOD_LFOS] = {0};
+    float lfoHeld[MOD_LFOS] = {0};           // Sample & hold value
+    uint32_t rng = 0x9E3779B9;
+    float env = 0.0f;
+    int heldKeys = 0;
+
+    int routeDest[MOD_SOURCES] = {0};
+    float routeDepth[MOD_SOURCES] = {0};
+
+    float value[MOD_DESTS] = {0};            // This block
+    float previous[MOD_DESTS] = {0};         // Last block, ramp start
+    bool active[MOD_DESTS] = {false};        // Routed now or still returning to zero
+} modState;
+
+inline float lfoValue(int lfo) {
+    uint32_t phase = modState.lfoPhase[lfo];
+    switch (modState.lfoShape[lfo]) {
+        case LFO_TRIANGLE: {
+            // Rises from -1 to 1 over the first half cycle, falls over the second
+            int32_t folded = (int32_t)(phase ^ (uint32_t)((int32_t)phase >> 31));
+            return folded * (2.0f / 2147483648.0f) - 1.0f;
+        }
+        case LFO_SAMPLE_HOLD:
+            return modState.lfoHeld[lfo];
+        default:
+            return sineTable[phase >> 24];
+    }
+}
+
+void updateModParams() {
+    if (!paramChanged(PARAM_MOD)) return;
+    for (int l = 0; l < MOD_LFOS; l++) {
+        modState.lfoShape[l] = backendSettings.mod.lfo[l].shape;
+        modState.lfoInc[l] = (uint32_t)(backendSettings.mod.lfo[l].rate * MOD_LFO_HZ_PER_STEP * 4294967296.0f / SAMPLE_RATE);
+    }
+    for (int s = 0; s < MOD_SOURCES; s++) {
+        modState.routeDest[s] = backendSettings.mod.route[s].dest;
+        modState.routeDepth[s] = backendSettings.mod.route[s].depth * MOD_DEPTH_SCALE[backendSettings.mod.route[s].dest];
+    }
+}
+
+// Called once per block before anything reads the destinations
+void modulationBlock(int length) {
+    updateModParams();
+
+    for (int l = 0; l < MOD_LFOS; l++) {
+        uint32_t before = modState.lfoPhase[l];
+        modState.lfoPhase[l] += modState.lfoInc[l] * length;
+        if (modState.lfoPhase[l] < before) {
+            // New cycle: next sample & hold step
+            uint32_t x = modState.rng;
+            x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+            modState.rng = x;
+            modState.lfoHeld[l] = (int32_t)x * (1.0f / 2147483648.0f);
+        }
+    }
+
+    int held = 0;
+    for (int i = 0; i < 96; ++i) {
+        if (__atomic_load_n(&notes.notes[i].active, __ATOMIC_RELAXED)) held++;
+    }
+    if (held > modState.heldKeys) modState.env = 1.0f;
+    else modState.env *= expf(-length / (MOD_ENV_DECAY_TIME * SAMPLE_RATE));
+    modState.heldKeys = held;
+
+    float sum[MOD_DESTS] = {0};
+    bool routed[MOD_DESTS] = {false};
+    for (int s = 0; s < MOD_SOURCES; s++) {
+        int dest = modState.routeDest[s];
+        if (dest == MOD_DEST_OFF) continue;
+        float source = (s == MOD_SRC_ENV) ? modState.env : lfoValue(s);
+        sum[dest] += source * modState.routeDepth[s];
+        routed[dest] = true;
+    }
+    for (int d = 1; d < MOD_DESTS; d++) {
+        modState.previous[d] = modState.value[d];
+        modState.value[d] = sum[d];
+        // An unrouted destination stays active for one block while it ramps back
+        modState.active[d] = routed[d] || modState.previous[d] != 0.0f;
+    }
+}
+
+inline float modValue(int dest) {
+    return modState.value[dest];
+}
+
+inline bool modActive(int dest) {
+    return modState.active[dest];
+}
+
+// Tremolo: gain ramps from last block's value to this one's
+void modApplyAmplitude(float* block, int length) {
+    if (!modActive(MOD_DEST_AMP)) return;
+    float gain = std::max(0.0f, 1.0f + modState.previous[MOD_DEST_AMP]);
+    float target = std::max(0.0f, 1.0f + modState.value[MOD_DEST_AMP]);
+    float step = (target - gain) / length;
+    for (int n = 0; n < length; n++) {
+        block[n] *= gain;
+        gain += step;
+    }
+}
+
+// Scales what the effect chain added to `dry`, from 0 (dry) to 2x
+void modApplyEffectMix(float* block, const float* dry, int length) {
+    float mix = constrain(1.0f + modState.previous[MOD_DEST_FX_MIX], 0.0f, 2.0f);
+    float target = constrain(1.0f + modState.value[MOD_DEST_FX_MIX], 0.0f, 2.0f);
+    float step = (target - mix) / length;
+    for (int n = 0; n < length; n++) {
+        block[n] = dry[n] + (block[n] - dry[n]) * mix;
+        mix += step;
+    }
+}
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef MORPH_H
+#define MORPH_H
+
+#include "pin.h"
+#include "params.h"
+#include "modmatrix.h"
+#include <math.h>
+
+// -------------------- Wavetable Morph Oscillator --------------------
+// Blends two adjacent single-cycle tables into morphTable once per block, so
+// the table voices still do a single lookup per sample. The position comes
+// from the knob directly, from an envelope restarted on each new key, or from
+// an LFO; the knob sets the depth for the latter two.
+const int MORPH_TABLES = 9;
+const int MORPH_STEPS = 8;                                  // Knob steps per pair of tables
+const int MORPH_MAX_POSITION = MORPH_STEPS * (MORPH_TABLES - 1);
+const int MORPH_TABLE_SIZE = sizeof(sineTable) / sizeof(sineTable[0]);
+
+float* const morphTables[MORPH_TABLES] = {
+    sineTable, triangleTable, squareTable, pianoTable, saxophoneTable,
+    bellTable, fluteTable, dingTable, dongTable
+};
+
+enum MorphSource { MORPH_KNOB, MORPH_ENVELOPE, MORPH_LFO, MORPH_SOURCES };
+const char* const morphSourceNames[MORPH_SOURCES] = {"Knob", "Env", "LFO"};
+
+float morphTable[MORPH_TABLE_SIZE];
+
+struct {
+    float depth = 0.0f;          // In tables
+    int source = MORPH_KNOB;
+    float envStep = 0.0f;        // Per sample
+    float lfoStep = 0.0f;        // Radians per sample
+    float env = 0.0f;
+    float lfoPhase = 0.0f;
+    int heldKeys = 0;
+    float builtPosition = -1.0f;
+} morphState;
+
+// Called once per block while the morph wave is selected
+void updateMorphTable(int length) {
+    if (paramChanged(PARAM_MORPH)) {
+        morphState.depth = (float)backendSettings.morph.position / MORPH_STEPS;
+        morphState.source = backendSettings.morph.source;
+        // Rate 1..10: envelope falls over 0.1..1 s, LFO runs at 0.25..2.5 Hz
+        morphState.envStep = 1.0f / (backendSettings.morph.rate * 0.1f * SAMPLE_RATE);
+        morphState.lfoStep = 2.0f * PI * backendSettings.morph.rate * 0.25f / SAMPLE_RATE;
+    }
+
+    int held = 0;
+    for (int i = 0; i < 96; ++i) {
+        if (__atomic_load_n(&notes.notes[i].active, __ATOMIC_RELAXED)) held++;
+    }
+    if (held > morphState.heldKeys) morphState.env = 1.0f;
+    morphState.heldKeys = held;
+
+    float position;
+    switch (morphState.source) {
+        case MORPH_ENVELOPE:
+            position = morphState.depth * morphState.env;
+            morphState.env = std::max(0.0f, morphState.env - morphState.envStep * length);
+            break;
+        case MORPH_LFO:
+            position = morphState.depth * (0.5f - 0.5f * cosf(morphState.lfoPhase));
+            morphState.lfoPhase = fmodf(morphState.lfoPhase + morphState.lfoStep * length, 2.0f * PI);
+            break;
+        default:
+            position = morphState.depth;
+            break;
+    }
+
+    position = constrain(position + modValue(MOD_DEST_MORPH), 0.0f, (float)(MORPH_TABLES - 1));
+    if (position == morphState.builtPosition) return;
+    morphState.builtPosition = position;
+
+    int first = std::min((int)position, MORPH_TABLES - 2);
+    float mix = position - first;
+    const float* a = morphTables[first];
+    const float* b = morphTables[first + 1];
+    for (int i = 0; i < MORPH_TABLE_SIZE; i++) {
+        morphTable[i] = a[i] + (b[i] - a[i]) * mix;
+    }
+}
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef MPSCRING_H
+#define MPSCRING_H
+
+#include <stdint.h>
+
+// -------------------- Lock-Free Event Ring --------------------
+// Bounded multi-producer, single-consumer ring. Producers (tasks or ISRs)
+// claim a slot with a compare-and-swap on `head` and publish it through the
+// slot's sequence number, so a producer preempted half way only delays the
+// consumer, never corrupts it. A full ring drops the item and counts it.
+template <typename T, uint32_t N>
+struct MpscRing {
+    static_assert((N & (N - 1)) == 0, "ring size must be a power of two");
+
+    struct Slot {
+        uint32_t sequence;
+        T item;
+    };
+
+    Slot slots[N];
+    uint32_t head = 0;                          // Next to post
+    uint32_t tail = 0;                          // Next to take (consumer only)
+    uint32_t overflows = 0;                     // Items dropped on a full ring
+    uint32_t highWater = 0;                     // Deepest the ring has been
+
+    // Before anything posts
+    void init() {
+        for (uint32_t i = 0; i < N; i++) slots[i].sequence = i;
+        head = 0;
+        tail = 0;
+        overflows = 0;
+        highWater = 0;
+    }
+
+    bool post(const T& item) {
+        uint32_t pos = __atomic_load_n(&head, __ATOMIC_RELAXED);
+        Slot* slot;
+        while (1) {
+            slot = &slots[pos & (N - 1)];
+            int32_t diff = (int32_t)(__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) - pos);
+            if (diff == 0) {
+                if (__atomic_compare_exchange_n(&head, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) break;
+            } else if (diff < 0) {
+                __atomic_add_fetch(&overflows, 1, __ATOMIC_RELAXED);
+                return false;
+            } else {
+                pos = __atomic_load_n(&head, __ATOMIC_RELAXED);
+            }
+        }
+        slot->item = item;
+        __atomic_store_n(&slot->sequence, pos + 1, __ATOMIC_RELEASE);
+
+        uint32_t depth = pos + 1 - __atomic_load_n(&tail, __ATOMIC_RELAXED);
+        uint32_t peak = __atomic_load_n(&highWater, __ATOMIC_RELAXED);
+        while (depth > peak &&
+               !__atomic_compare_exchange_n(&highWater, &peak, depth, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+        return true;
+    }
+
+    // Consumer only; false when empty
+    bool take(T& item) {
+        Slot& slot = slots[tail & (N - 1)];
+        if (__atomic_load_n(&slot.sequence, __ATOMIC_ACQUIRE) != tail + 1) return false;
+        item = slot.item;
+        __atomic_store_n(&slot.sequence, tail + N, __ATOMIC_RELEASE);
+        __atomic_store_n(&tail, tail + 1, __ATOMIC_RELAXED);
+        return true;
+    }
+};
+
+#endif
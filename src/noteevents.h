@@ -0,0 +1,75 @@
+#ifndef NOTEEVENTS_H
+#define NOTEEVENTS_H
+
+#include "pin.h"
+#include "mpscring.h"
+
+// -------------------- Note Event Bus --------------------
+// Every note on/off, local or from CAN, goes through one lock-free ring
+// instead of writing notes[].active under notes.mutex. The audio task drains
+// it at the start of each effect block and is the only writer of the active
+// flags, so nothing on the audio path takes a lock. A note released in the
+// same block it was pressed is held for one block, so short taps still sound
+// and engines still see the edge.
+const uint32_t NOTE_EVENT_RING = 64;
+
+enum NoteEventType : uint8_t { NOTE_EVENT_OFF, NOTE_EVENT_ON };
+
+struct NoteEvent {
+    uint8_t type;                               // NoteEventType
+    uint8_t note;                               // 0..95, (octave - 1) * 12 + key
+    uint8_t board;                              // posId of the board that played it
+    uint32_t time;                              // Tick count when posted
+};
+
+// overflows and highWater are the bus diagnostics
+MpscRing<NoteEvent, NOTE_EVENT_RING> noteEventRing;
+
+uint32_t noteDeferredOff[3] = {0};              // Releases held over to the next block
+
+// Before any task posts
+void noteEventsInit() {
+    noteEventRing.init();
+    memset(noteDeferredOff, 0, sizeof(noteDeferredOff));
+}
+
+// Any task; false (and counted) if the ring is full or the note out of range
+bool noteEventPost(NoteEventType type, int note, int board) {
+    if (note < 0 || note >= 96) return false;
+    return noteEventRing.post({(uint8_t)type, (uint8_t)note, (uint8_t)board, (uint32_t)xTaskGetTickCount()});
+}
+
+inline void noteSetActive(int note, bool active) {
+    __atomic_store_n(&notes.notes[note].active, active, __ATOMIC_RELAXED);
+}
+
+// Audio task, at block start: apply last block's held-over releases, then
+// every posted event
+void noteEventsDrain() {
+    uint32_t pressed[3] = {0};
+    for (int w = 0; w < 3; w++) {
+        uint32_t deferred = noteDeferredOff[w];
+        noteDeferredOff[w] = 0;
+        while (deferred) {
+            noteSetActive(w * 32 + __builtin_ctz(deferred), false);
+            deferred &= deferred - 1;
+        }
+    }
+
+    NoteEvent event;
+    while (noteEventRing.take(event)) {
+        uint32_t bit = 1u << (event.note & 31);
+        int w = event.note >> 5;
+        if (event.type == NOTE_EVENT_ON) {
+            pressed[w] |= bit;
+            noteDeferredOff[w] &= ~bit;
+            noteSetActive(event.note, true);
+        } else if (pressed[w] & bit) {
+            noteDeferredOff[w] |= bit;
+        } else {
+            noteSetActive(event.note, false);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <math.h>
+#include <stdint.h>
+
+// Output width: 8 for PWM, 12 for the DAC on OUTR_PIN (e.g. -DOUTPUT_BITS=12)
+#ifndef OUTPUT_BITS
+#define OUTPUT_BITS 8
+#endif
+const uint32_t OUTPUT_MAX = (1u << OUTPUT_BITS) - 1;
+#if OUTPUT_BITS > 8
+typedef uint16_t sample_t;
+#else
+typedef uint8_t sample_t;
+#endif
+
+// -------------------- Output Requantizer --------------------
+// The mix stays in float (8-bit full scale = 255) until here. Each sample gets
+// TPDF dither and an error-feedback noise shaper before it is truncated to
+// OUTPUT_BITS, so quiet passages and volume steps turn into benign noise
+// pushed towards high frequencies instead of correlated distortion.
+//   order 0: plain TPDF dither
+//   order 1: NTF = 1 - z^-1
+//   order 2: NTF = (1 - z^-1)^2
+// Included by pin.h and plain C++, so tools/outputbench.cpp runs it on a host.
+#ifndef NOISE_SHAPING_ORDER
+#define NOISE_SHAPING_ORDER 2
+#endif
+
+const float OUTPUT_SCALE = (float)(1u << OUTPUT_BITS) / 256.0f;
+
+struct {
+    int order = NOISE_SHAPING_ORDER;
+    float error1 = 0.0f;     // e[n-1]
+    float error2 = 0.0f;     // e[n-2]
+    uint32_t rng = 0x12345678;
+} outputShaper;
+
+void resetOutputShaper() {
+    outputShaper.error1 = 0.0f;
+    outputShaper.error2 = 0.0f;
+}
+
+// Triangular dither in [-1, 1) LSB from the two halves of one xorshift32 draw
+inline float tpdfDither() {
+    uint32_t x = outputShaper.rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    outputShaper.rng = x;
+    return ((x & 0xFFFF) + (x >> 16)) * (1.0f / 65536.0f) - 1.0f;
+}
+
+// Convert one mix sample to the DAC width
+inline sample_t requantize(float amp) {
+    float v = amp * OUTPUT_SCALE;
+    if (outputShaper.order == 1) {
+        v -= outputShaper.error1;
+    } else if (outputShaper.order == 2) {
+        v -= 2.0f * outputShaper.error1 - outputShaper.error2;
+    }
+
+    float q = floorf(v + tpdfDither() + 0.5f);
+
+    // Error is taken before clipping so the loop stays bounded
+    outputShaper.error2 = outputShaper.error1;
+    outputShaper.error1 = q - v;
+
+    if (q < 0.0f) return 0;
+    if (q > (float)OUTPUT_MAX) return OUTPUT_MAX;
+    return (sample_t)q;
+}
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef PARAMS_H
+#define PARAMS_H
+
+#include <Arduino.h>
+#include "pin.h"
+
+// -------------------- Control Parameter Groups --------------------
+// Each group covers the settings one menu page edits. Writers bump the group's
+// version after changing any of its fields; the backend compares versions at
+// block start and only then recomputes the derived coefficients.
+enum ParamId {
+    PARAM_REVERB,
+    PARAM_DISTORTION,
+    PARAM_CHORUS,
+    PARAM_DELAY,
+    PARAM_LPF,
+    PARAM_EQ,
+    PARAM_FM,
+    PARAM_MORPH,
+    PARAM_UNISON,
+    PARAM_ADDITIVE,
+    PARAM_BEND,
+    PARAM_TUNING,
+    PARAM_MOD,
+    PARAM_COUNT
+};
+
+uint32_t paramVersions[PARAM_COUNT] = {0};
+uint32_t seenParamVersions[PARAM_COUNT] = {0};
+
+void touchParam(ParamId id) {
+    __atomic_add_fetch(&paramVersions[id], 1, __ATOMIC_RELEASE);
+}
+
+// Write a setting and bump its group only if the value actually changed
+template <typename T>
+void writeParam(T& field, T value, ParamId id) {
+    if (field != value) {
+        field = value;
+        touchParam(id);
+    }
+}
+
+// -------------------- Settings Snapshot --------------------
+// Writers edit `settings` under settings.mutex and then publish a complete
+// copy, with the group versions, through a seqlock. The backend takes one
+// consistent copy per buffer into backendSettings and reads nothing else, so
+// a knob turn can't mix old and new values inside a block and the backend
+// never waits on the mutex. The writers outrank the backend, so a copy torn
+// by a publish is retried once the publish has finished.
+struct SettingsSnapshot {
+    setting values;
+    uint32_t versions[PARAM_COUNT];
+};
+
+struct {
+    uint32_t sequence = 0;                      // Odd while a publish is in progress
+    SettingsSnapshot snapshot;
+} settingsSeqlock;
+
+setting backendSettings;                        // Backend only
+uint32_t backendParamVersions[PARAM_COUNT] = {0};
+uint32_t settingsSnapshotRetries = 0;           // Copies torn by a publish
+
+// Writers, before giving settings.mutex; also once after start-up
+void settingsPublish() {
+    uint32_t sequence = settingsSeqlock.sequence;
+    __atomic_store_n(&settingsSeqlock.sequence, sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(&settingsSeqlock.snapshot.values, &settings, sizeof(setting));
+    for (int i = 0; i < PARAM_COUNT; i++) {
+        settingsSeqlock.snapshot.versions[i] = __atomic_load_n(&paramVersions[i], __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&settingsSeqlock.sequence, sequence + 2, __ATOMIC_RELEASE);
+}
+
+// Backend, at buffer start. Copies into a scratch snapshot and only takes it
+// once the sequence check passes, so a publish caught half way (only
+// possible from a lower-priority writer) keeps the previous one; false then.
+bool settingsSnapshot() {
+    static SettingsSnapshot copy;               // Static: too big for the backend stack
+    while (1) {
+        uint32_t sequence = __atomic_load_n(&settingsSeqlock.sequence, __ATOMIC_ACQUIRE);
+        if (sequence & 1) return false;
+        memcpy(&copy, &settingsSeqlock.snapshot, sizeof(copy));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&settingsSeqlock.sequence, __ATOMIC_RELAXED) == sequence) break;
+        settingsSnapshotRetries++;
+    }
+    memcpy(&backendSettings, &copy.values, sizeof(setting));
+    memcpy(backendParamVersions, copy.versions, sizeof(backendParamVersions));
+    return true;
+}
+
+// Backend side: true once per version change in the snapshot
+bool paramChanged(ParamId id) {
+    uint32_t version = backendParamVersions[id];
+    if (version == seenParamVersions[id]) return false;
+    seenParamVersions[id] = version;
+    return true;
+}
+
+// Mark every group as changed so the next control block recomputes everything
+void invalidateParams() {
+    for (int i = 0; i < PARAM_COUNT; i++) {
+        seenParamVersions[i] = backendParamVersions[i] - 1;
+    }
+}
+
+// -------------------- Smoothed Parameter --------------------
+// Ramps linearly from its current value to a new target across one control
+// block. Every parameter gets either setTarget() or settle() at block start.
+struct SmoothedParam {
+    float current = 0.0f;
+    float target = 0.0f;
+    float step = 0.0f;
+
+    void setTarget(float value, int length) {
+        target = value;
+        step = (target - current) / length;
+    }
+
+    void settle() {
+        current = target;
+        step = 0.0f;
+    }
+
+    float next() {
+        current += step;
+        return current;
+    }
+};
+
+#endif
@@ -3,13 +3,15 @@
 
 #include <Arduino.h>
 #include <U8g2lib.h>
-#include <bitset>
 #include <string>
 
 // ============================ Sampling Settings ============================
 #define SAMPLE_RATE 22000
 const uint32_t sampleRate = SAMPLE_RATE;
 
+// Output width and requantizer
+#include "output.h"
+
 // ============================ CAN Settings ============================
 uint32_t ID = 0x123;
 uint8_t RX_Message[8] = {0};
@@ -22,8 +24,8 @@ SemaphoreHandle_t CAN_TX_Semaphore;
 
 // ============================ Sample Buffer ============================
 const int SAMPLE_BUFFER_SIZE = 2200;
-uint8_t sampleBuffer0[SAMPLE_BUFFER_SIZE / 2];
-uint8_t sampleBuffer1[SAMPLE_BUFFER_SIZE / 2];
+sample_t sampleBuffer0[SAMPLE_BUFFER_SIZE / 2];
+sample_t sampleBuffer1[SAMPLE_BUFFER_SIZE / 2];
 volatile bool writeBuffer1 = false;
 SemaphoreHandle_t sampleBufferSemaphore;
 
@@ -34,18 +36,25 @@ TaskHandle_t decodeTaskHandle      = NULL;
 TaskHandle_t CAN_TX_Handle         = NULL;
 TaskHandle_t BackCalc_Handle       = NULL;
 TaskHandle_t scanJoystick_Handle   = NULL;
+TaskHandle_t additiveGen_Handle    = NULL;
+TaskHandle_t log_Handle            = NULL;
 
 // ============================ Display Driver ============================
 U8G2_SSD1305_128X32_NONAME_F_HW_I2C u8g2(U8G2_R0);
 
 // ============================ Input Matrix ============================
-const size_t inputSize = 28;
-std::string movement;
+#include "inputfields.h"
 
 // ============================ Display Menu Info ============================
-std::string bottomBar_menu[4] = {"Menu", "Wave", "Tone", "Vol"};
-std::string waveNames[9] = {"Saw", "Sin", "Squ", "Tri", "Pia", "Saxo", "Bell", "Alar", "None"};
-std::string menu_first_level[7] = {"MET", "ADSR", "LPF", "DIS", "CHO", "REV", "exit"};
+const char* const bottomBar_menu[4] = {"Menu", "Wave", "Tone", "Vol"};
+// Indices from WAVE_FM on select a synthesis engine instead of a table
+const int WAVE_FM = 9;
+const int WAVE_PLUCK = 10;
+const int WAVE_SAMPLE = 11;
+const int WAVE_MORPH = 12;
+const int WAVE_ADDITIVE = 13;
+const int NUM_WAVES = 14;
+const char* const waveNames[NUM_WAVES] = {"Saw", "Sin", "Squ", "Tri", "Pia", "Saxo", "Bell", "Alar", "None", "FM", "Plk", "Smp", "Mor", "Add"};
 
 // ============================ System Structs ============================
 
@@ -56,13 +65,13 @@ struct knob {
 };
 
 struct {
-    std::bitset<inputSize> inputs;
+    uint32_t inputs = INPUT_IDLE;
     SemaphoreHandle_t mutex;
     std::array<knob, 4> knobValues;
     uint8_t local_boardId = HAL_GetUIDw0();
-    std::bitset<1> WestDetect;
-    std::bitset<1> EastDetect;
-    std::string currentMenu = "Main";
+    bool WestDetect = false;
+    bool EastDetect = false;
+    uint8_t currentMenu = 0;                // MenuPage (ui.h), PAGE_HOME
     int joystickState = 0;
     bool singleMode = true;
     int posId = 0;
@@ -76,9 +85,9 @@ struct note {
     bool active;
 };
 
+// active is written only by the audio task, from the note event bus
 struct {
     std::array<note, 96> notes;
-    SemaphoreHandle_t mutex;
 } notes;
 
 struct ADSR {
@@ -88,11 +97,27 @@ struct ADSR {
     int sustain;
 };
 
-// struct LFO {
-//     bool on;
-//     int freq;
-//     int reduceLFOVolume;
-// };
+// Shape is an LfoShape (see modmatrix.h), rate in 0.5 Hz steps
+const int MOD_LFOS = 3;
+struct LFO {
+    int shape;
+    int rate;
+};
+
+// Destination is a ModDest, depth -10..10
+struct ModRoute {
+    int dest;
+    int depth;
+};
+
+// One route per source (the LFOs, then the key envelope); the edit indices
+// pick which LFO / source the menu pages show
+struct ModSettings {
+    LFO lfo[MOD_LFOS];
+    ModRoute route[MOD_LFOS + 1];
+    int lfoEdit;
+    int sourceEdit;
+};
 
 struct Metronome {
     bool on;
@@ -100,10 +125,66 @@ struct Metronome {
 };
 
 struct Lowpass {
-    int on;
+    bool on;
     int freq;
 };
 
+// Envelope per operator is an FmEnvPreset (see fm.h); opEdit picks which
+// operator the envelope page shows
+const int FM_OPERATORS = 4;
+struct FmSettings {
+    int algorithm;
+    int ratio;       // Modulator frequency ratio
+    int index;       // Modulation index, 0..10
+    int env[FM_OPERATORS];
+    int opEdit;
+};
+
+// Position in 1/8 table steps; source is a MorphSource
+struct MorphSettings {
+    int position;
+    int source;
+    int rate;
+};
+
+// Copies per note (1 = off) and detune spread in 5 cent steps
+struct UnisonSettings {
+    int voices;
+    int detune;
+};
+
+// Preset index into additiveTimbres
+struct AdditiveSettings {
+    int timbre;
+};
+
+// Bend range in semitones, vibrato rate in 0.8 Hz steps and depth in 10 cent steps
+struct BendSettings {
+    int range;
+    int rate;
+    int depth;
+};
+
+// Index into tuningScales, root key (0 = C) and reference A in Hz
+struct TuningSettings {
+    int system;
+    int root;
+    int reference;
+};
+
+// Board (posId, 0 = none) whose keys play pads, and the pattern (0 = off)
+struct DrumSettings {
+    bool on;
+    int board;
+    int pattern;
+};
+
+// Gains are in 3 dB steps: low shelf, mid peak, high shelf
+struct Equalizer {
+    bool on;
+    int gain[3];
+};
+
 // struct Fade {
 //     int on;
 //     int sustainTime;
@@ -113,9 +194,17 @@ struct Lowpass {
 struct setting {
     Metronome metronome;
     // Fade fade;
-    // LFO lfo;
+    ModSettings mod;
     ADSR adsr;
     Lowpass lowpass;
+    Equalizer eq;
+    FmSettings fm;
+    MorphSettings morph;
+    UnisonSettings unison;
+    DrumSettings drums;
+    AdditiveSettings additive;
+    BendSettings bend;
+    TuningSettings tuning;
     int volume;
     int tune;
     int waveIndex;
@@ -128,6 +217,9 @@ struct setting {
     int distortion_strength = 150;
     bool chorus_on = false;
     int chorus_strength = 150;
+    bool delay_on = false;
+    int delay_strength = 5;
+    int delay_division = 4;
 } settings;
 
 // ============================ PIN Mappings ============================
@@ -159,7 +251,7 @@ const int DRST_BIT = 4;
 const int HKOW_BIT = 5;
 const int HKOE_BIT = 6;
 
-std::array<std::string, 12> noteNames = {
+const char* const noteNames[12] = {
   "C", "C#", "D", "D#", "E", "F",
   "F#", "G", "G#", "A", "A#", "B"
 };
@@ -284,11 +376,14 @@ float noteFrequencies[96]={
 
 // ---------------------------------- Phase LUT ----------------------------------
 float notePhases[96];
+// Same increments as 32-bit phase accumulator steps, for the synthesis engines
+uint32_t notePhaseIncs[96];
 
 // Precompute phase increment table based on note frequencies
 void generatePhaseLUT() {
     for (int i = 0; i < 96; ++i) {
         notePhases[i] = noteFrequencies[i] * M_PI / SAMPLE_RATE;
+        notePhaseIncs[i] = (uint32_t)(fmod(notePhases[i], 1.0) * 4294967296.0);
     }
 }
 
@@ -306,12 +401,51 @@ void init_settings() {
     settings.lowpass.on = false;
     settings.lowpass.freq = 500;
 
+    settings.eq.on = false;
+    settings.eq.gain[0] = 0;
+    settings.eq.gain[1] = 0;
+    settings.eq.gain[2] = 0;
+
+    settings.fm.algorithm = 0;
+    settings.fm.ratio = 2;
+    settings.fm.index = 4;
+    for (int op = 0; op < FM_OPERATORS; op++) settings.fm.env[op] = 0;
+    settings.fm.opEdit = 0;
+
+    settings.morph.position = 8;
+    settings.morph.source = 0;
+    settings.morph.rate = 4;
+
+    settings.unison.voices = 1;
+    settings.unison.detune = 4;
+
+    settings.drums.on = false;
+    settings.drums.board = 0;
+    settings.drums.pattern = 0;
+
+    settings.additive.timbre = 0;
+
+    settings.bend.range = 2;
+    settings.bend.rate = 7;
+    settings.bend.depth = 5;
+
+    settings.tuning.system = 0;
+    settings.tuning.root = 0;
+    settings.tuning.reference = 440;
+
     settings.metronome.on = false;
     settings.metronome.speed = 8;
 
-    // settings.lfo.on = false;
-    // settings.lfo.freq = 20;
-    // settings.lfo.reduceLFOVolume = 2;
+    for (int l = 0; l < MOD_LFOS; l++) {
+        settings.mod.lfo[l].shape = 0;
+        settings.mod.lfo[l].rate = 4 * (l + 1);
+    }
+    for (int s = 0; s <= MOD_LFOS; s++) {
+        settings.mod.route[s].dest = 0;
+        settings.mod.route[s].depth = 5;
+    }
+    settings.mod.lfoEdit = 0;
+    settings.mod.sourceEdit = 0;
 
     settings.volume = 4;
     settings.tune = 4;
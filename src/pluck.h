@@ -0,0 +1,164 @@
+#ifndef PLUCK_H
+#define PLUCK_H
+
+#include "pin.h"
+#include "voices.h"
+#include <math.h>
+
+// -------------------- Karplus-Strong Plucked String --------------------
+// A noise burst circulates in a delay line one period long; a two-point
+// average and a loss gain in the loop damp the high harmonics first. The
+// period is taken from notePhases (so it tunes with the table voices) and split
+// into an integer delay plus a first-order allpass for the fractional part,
+// which keeps the short high-note loops in tune. Loop gain and averaging weight
+// are set per note from decay times, so high strings don't die in a few
+// milliseconds. One delay line per pool slot.
+const int PLUCK_DELAY_BITS = 8;
+const int PLUCK_DELAY_SIZE = 1 << PLUCK_DELAY_BITS;   // Longest period is C1, ~214 samples
+const int PLUCK_DELAY_MASK = PLUCK_DELAY_SIZE - 1;
+const float PLUCK_MIN_PERIOD = 3.0f;      // Notes above ~7.3 kHz hold this period
+const float PLUCK_HELD_T60 = 6.0f;        // Seconds to -60 dB from loop gain alone
+const float PLUCK_RELEASED_T60 = 0.2f;
+const float PLUCK_FUNDAMENTAL_T60 = 2.0f; // Shortest fundamental decay the averaging may cause
+const int32_t PLUCK_SILENCE = 48;         // Q15 peak below which a voice is freed
+
+struct PluckVoice {
+    int32_t gainNow, gainLast;         // Q15 loop filter taps: loss * (1 - S), loss * S
+    int32_t releaseNow, releaseLast;   // Same with the release loss
+    int32_t apCoef;          // Q15 allpass coefficient
+    int32_t apIn1, apOut1;   // Allpass state
+    int32_t last;            // Previous delay output, for the averaging filter
+    int32_t level;           // Q15 amplitude follower, offsets output to unipolar
+    int32_t levelStep;
+    uint16_t period;         // Integer part of the loop delay
+    uint16_t writePos;
+};
+
+int16_t pluckDelayLines[MAX_VOICES][PLUCK_DELAY_SIZE];
+PluckVoice pluckVoices[MAX_VOICES];
+uint32_t pluckRng = 0x9E3779B9;
+
+inline int32_t pluckNoise() {
+    pluckRng ^= pluckRng << 13;
+    pluckRng ^= pluckRng >> 17;
+    pluckRng ^= pluckRng << 5;
+    return (int16_t)pluckRng >> 1;     // +/- half scale
+}
+
+inline int16_t saturate16(int32_t value) {
+    if (value > INT16_MAX) return INT16_MAX;
+    if (value < INT16_MIN) return INT16_MIN;
+    return (int16_t)value;
+}
+
+// Loop gain per period reaching -60 dB after t60 seconds
+float pluckLoss(float period, float t60) {
+    return powf(10.0f, -3.0f * period / (SAMPLE_RATE * t60));
+}
+
+// Q15 product rounded toward zero, so the loop can only lose energy
+inline int32_t pluckShift(int32_t value) {
+    return (value + ((value >> 31) & 0x7FFF)) >> 15;
+}
+
+// Loop delay = period + averaging delay + allpass delay in [0.1, 1.1), with
+// both filter delays taken at the fundamental rather than at DC
+void pluckTune(PluckVoice& v, int note) {
+    float length = constrain(1.0f / notePhases[note], PLUCK_MIN_PERIOD, (float)(PLUCK_DELAY_SIZE - 1));
+    float w = 2.0f * PI / length;
+
+    // Averaging weight S: gain at the fundamental is sqrt(1 - 2S(1-S)(1-cos w)).
+    // Full 0.5 for low notes, less where that would kill the fundamental too fast.
+    float g = powf(10.0f, -3.0f * length / (SAMPLE_RATE * PLUCK_FUNDAMENTAL_T60));
+    float k = (1.0f - g * g) / (2.0f * (1.0f - cosf(w)));
+    float smoothing = (k >= 0.25f) ? 0.5f : 0.5f * (1.0f - sqrtf(1.0f - 4.0f * k));
+    float averageDelay = atan2f(smoothing * sinf(w), 1.0f - smoothing + smoothing * cosf(w)) / w;
+
+    float loop = length - averageDelay;
+    int period = (int)(loop - 0.1f);
+    float frac = loop - period;
+    v.period = period;
+    v.apCoef = (int32_t)lrintf(32768.0f * sinf((1.0f - frac) * w / 2.0f) / sinf((1.0f + frac) * w / 2.0f));
+    float held = pluckLoss(length, PLUCK_HELD_T60);
+    float released = pluckLoss(length, PLUCK_RELEASED_T60);
+    v.gainNow = (int32_t)(32768.0f * held * (1.0f - smoothing));
+    v.gainLast = (int32_t)(32768.0f * held * smoothing);
+    v.releaseNow = (int32_t)(32768.0f * released * (1.0f - smoothing));
+    v.releaseLast = (int32_t)(32768.0f * released * smoothing);
+}
+
+void pluckStartVoice(int slot, int note) {
+    PluckVoice& v = pluckVoices[slot];
+    int16_t* line = pluckDelayLines[slot];
+    pluckTune(v, note);
+
+    // Zero-mean burst over the samples the loop will read, so no DC circulates
+    int32_t sum = 0;
+    for (int i = 0; i < v.period; i++) {
+        line[i] = pluckNoise();
+        sum += line[i];
+    }
+    int32_t mean = sum / v.period;
+    int32_t peak = 0;
+    for (int i = 0; i < v.period; i++) {
+        line[i] -= mean;
+        peak = std::max(peak, (int32_t)abs(line[i]));
+    }
+
+    v.writePos = v.period;
+    v.apIn1 = v.apOut1 = v.last = 0;
+    v.level = peak;
+    v.levelStep = 0;
+}
+
+void pluckReleaseVoice(int slot) {
+    pluckVoices[slot].gainNow = pluckVoices[slot].releaseNow;
+    pluckVoices[slot].gainLast = pluckVoices[slot].releaseLast;
+}
+
+// Accumulates one voice into the block; returns its peak magnitude (Q15)
+int32_t pluckRenderVoice(PluckVoice& v, int16_t* line, float* block, int length, float gain) {
+    int32_t peak = 0;
+    uint32_t w = v.writePos;
+    for (int n = 0; n < length; n++) {
+        int32_t x = line[(w - v.period) & PLUCK_DELAY_MASK];
+        int32_t damped = pluckShift(x * v.gainNow + v.last * v.gainLast);
+        v.last = x;
+        int32_t y = pluckShift(v.apCoef * (damped - v.apOut1)) + v.apIn1;
+        v.apIn1 = damped;
+        v.apOut1 = y;
+        line[w & PLUCK_DELAY_MASK] = saturate16(y);
+        w++;
+
+        v.level += v.levelStep;
+        block[n] += (y + v.level) * gain;
+        peak = std::max(peak, (int32_t)abs(y));
+    }
+    v.writePos = w & PLUCK_DELAY_MASK;
+    return peak;
+}
+
+// Called once per block; returns true while any string is ringing
+bool pluckRenderBlock(float* block, int length, int volume) {
+    voicePoolScan(pluckStartVoice, pluckReleaseVoice);
+
+    memset(block, 0, length * sizeof(float));
+    int sounding = voicesSounding();
+    if (sounding == 0) return false;
+
+    // Bipolar Q15 plus the level offset -> 8-bit units, averaged like the table voices
+    float gain = ldexpf(255.0f, volume - 8) / (65536.0f * sounding);
+
+    for (int v = 0; v < MAX_VOICES; v++) {
+        if (voicePool.slots[v].note < 0) continue;
+        PluckVoice& voice = pluckVoices[v];
+
+        int32_t peak = pluckRenderVoice(voice, pluckDelayLines[v], block, length, gain);
+        // The offset follows the decay one block behind with some headroom, ramped like the envelopes
+        voice.levelStep = (peak + (peak >> 3) - voice.level) / length;
+        if (peak < PLUCK_SILENCE) voiceFree(v);
+    }
+    return true;
+}
+
+#endif
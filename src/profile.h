@@ -0,0 +1,230 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <Arduino.h>
+#include <STM32FreeRTOS.h>
+#include "pin.h"
+
+// -------------------- Runtime Profiler --------------------
+// Every task body and ISR is bracketed by profileBegin()/profileEnd(), which
+// read the DWT cycle counter (a few dozen cycles a pair). Times are exclusive:
+// a probe that opens inside another and closes before it (an ISR, or a task
+// that preempts) is charged to itself and subtracted from the outer one, so
+// the loads add up and the remainder is idle.
+//
+// Time a task spends blocked inside its body (a mutex wait, delay(), a full
+// queue) is included: work that started earlier and finishes during the
+// block is not subtracted, and neither is idle time. Such overlaps are
+// counted by both probes, and a result that would go negative reads 0.
+//
+// Each slot keeps its run count, min/total/max execution cycles and the spread
+// of the period between starts, since boot or the last reset. Send 'p' over
+// serial for the table (printed by logTask, as Markdown for the README), 'r'
+// to restart it. Build with -DPROFILE=0 to compile the probes out.
+#ifndef PROFILE
+#define PROFILE 1
+#endif
+
+enum ProfileSlot : uint8_t {
+    PROF_SAMPLE_ISR,
+    PROF_KEYSCAN_ISR,
+    PROF_CAN_RX_ISR,
+    PROF_CAN_TX_ISR,
+    PROF_SCAN_KEYS,
+    PROF_KEY_EVENTS,
+    PROF_DECODE,
+    PROF_BACKEND,
+    PROF_CAN_TX,
+    PROF_DISPLAY,
+    PROF_JOYSTICK,
+    PROF_ADDITIVE,
+    PROF_LOG,
+    PROF_SLOTS
+};
+
+struct ProfileSlotInfo {
+    const char* name;
+    TaskHandle_t* task;                         // For the stack high-water mark; null for ISRs
+};
+
+const ProfileSlotInfo profileSlots[PROF_SLOTS] = {
+    {"sampleISR",   nullptr},
+    {"keyScanISR",  nullptr},
+    {"CAN_RX_ISR",  nullptr},
+    {"CAN_TX_ISR",  nullptr},
+    {"scanKeys",    &scanKeysHandle},
+    {"keyEvents",   &scanKeysHandle},
+    {"decode",      &decodeTaskHandle},
+    {"backend",     &BackCalc_Handle},
+    {"CAN_TX",      &CAN_TX_Handle},
+    {"display",     &displayUpdateHandle},
+    {"joystick",    &scanJoystick_Handle},
+    {"additive",    &additiveGen_Handle},
+    {"log",         &log_Handle},
+};
+
+struct ProfileStats {
+    uint32_t count;                             // Written last; the reader's sequence number
+    uint32_t minCycles, maxCycles;
+    uint64_t totalCycles;
+    uint32_t minPeriod, maxPeriod;              // Cycles between consecutive begins
+};
+
+// Owner side of a slot: only the task or ISR that probes it writes these,
+// except `nested`, which closing probes add to with interrupts masked
+struct ProfileProbe {
+    ProfileStats stats;
+    uint32_t start;                             // CYCCNT at profileBegin
+    uint32_t sequence;                          // Order of profileBegin calls
+    uint32_t nested;                            // Cycles of probes opened and closed inside this one
+    uint32_t lastStart;
+    bool resetPending;                          // Set by profileReset, applied by the owner
+};
+
+ProfileProbe profileProbes[PROF_SLOTS];
+uint32_t profileOpen = 0;                       // Bit per slot with a probe open
+uint32_t profileSequence = 0;
+
+// First thing in setup, before any ISR or task is started
+void profileInit() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    for (int i = 0; i < PROF_SLOTS; i++) profileProbes[i].resetPending = true;
+}
+
+#if PROFILE
+inline void profileBegin(ProfileSlot slot) {
+    ProfileProbe& probe = profileProbes[slot];
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t now = DWT->CYCCNT;
+    probe.sequence = ++profileSequence;
+    probe.nested = 0;
+    profileOpen |= 1u << slot;
+    __set_PRIMASK(primask);
+
+    ProfileStats& stats = probe.stats;
+    if (probe.resetPending) {
+        probe.resetPending = false;
+        __atomic_store_n(&stats.count, 0, __ATOMIC_RELEASE);
+        stats.minCycles = UINT32_MAX;
+        stats.maxCycles = 0;
+        stats.totalCycles = 0;
+        stats.minPeriod = UINT32_MAX;
+        stats.maxPeriod = 0;
+    } else if (stats.count != 0) {
+        uint32_t period = now - probe.lastStart;
+        if (period < stats.minPeriod) stats.minPeriod = period;
+        if (period > stats.maxPeriod) stats.maxPeriod = period;
+    }
+    probe.lastStart = now;
+    probe.start = now;
+}
+
+inline void profileEnd(ProfileSlot slot) {
+    ProfileProbe& probe = profileProbes[slot];
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t elapsed = DWT->CYCCNT - probe.start;
+    uint32_t cycles = (elapsed > probe.nested) ? elapsed - probe.nested : 0;
+    profileOpen &= ~(1u << slot);
+    // Charge this probe only to those opened before it
+    for (uint32_t open = profileOpen; open; open &= open - 1) {
+        ProfileProbe& outer = profileProbes[__builtin_ctz(open)];
+        if ((int32_t)(outer.sequence - probe.sequence) < 0) outer.nested += cycles;
+    }
+    __set_PRIMASK(primask);
+
+    ProfileStats& stats = probe.stats;
+    if (cycles < stats.minCycles) stats.minCycles = cycles;
+    if (cycles > stats.maxCycles) stats.maxCycles = cycles;
+    stats.totalCycles += cycles;
+    __atomic_store_n(&stats.count, stats.count + 1, __ATOMIC_RELEASE);
+}
+#else
+inline void profileBegin(ProfileSlot) {}
+inline void profileEnd(ProfileSlot) {}
+#endif
+
+// Any task; a slot copied while its owner updates it is read again
+ProfileStats profileRead(ProfileSlot slot) {
+    const ProfileProbe& probe = profileProbes[slot];
+    ProfileStats copy = {};
+    if (__atomic_load_n(&probe.resetPending, __ATOMIC_RELAXED)) return copy;
+    for (int attempt = 0; attempt < 3; attempt++) {
+        uint32_t count = __atomic_load_n(&probe.stats.count, __ATOMIC_ACQUIRE);
+        copy = probe.stats;
+        if (__atomic_load_n(&probe.stats.count, __ATOMIC_ACQUIRE) == count) break;
+    }
+    return copy;
+}
+
+uint64_t profileWindowCycles = 0;               // Cycles since the last reset
+uint32_t profileWindowLast = 0;                 // CYCCNT when the window was last extended
+
+// logTask, every drain: extends the window well inside one CYCCNT wrap (53 s)
+void profileWindowUpdate() {
+    uint32_t now = DWT->CYCCNT;
+    profileWindowCycles += now - profileWindowLast;
+    profileWindowLast = now;
+}
+
+// logTask
+void profileReset() {
+    for (int i = 0; i < PROF_SLOTS; i++) __atomic_store_n(&profileProbes[i].resetPending, true, __ATOMIC_RELAXED);
+    profileWindowCycles = 0;
+    profileWindowLast = DWT->CYCCNT;
+}
+
+// Cycles to microseconds with one decimal
+void profileFormatUs(char* out, size_t size, uint64_t cycles) {
+    uint64_t tenths = cycles * 10 / (SystemCoreClock / 1000000);
+    snprintf(out, size, "%lu.%lu", (unsigned long)(tenths / 10), (unsigned long)(tenths % 10));
+}
+
+// logTask only, between log frames; logdecode passes the text through
+void profileDump() {
+    profileWindowUpdate();
+
+    Serial.println();
+    Serial.println("| Task | Runs | Min (us) | Avg (us) | Max (us) | Period (us) | CPU | Stack free (words) |");
+    Serial.println("|------|------|----------|----------|----------|-------------|-----|--------------------|");
+    uint64_t busyCycles = 0;
+    char line[128], minUs[12], avgUs[12], maxUs[12], period[24], stack[8];
+    for (int i = 0; i < PROF_SLOTS; i++) {
+        ProfileStats stats = profileRead((ProfileSlot)i);
+        busyCycles += stats.totalCycles;
+
+        strcpy(minUs, "-");
+        strcpy(avgUs, "-");
+        strcpy(maxUs, "-");
+        strcpy(period, "-");
+        if (stats.count != 0) {
+            profileFormatUs(minUs, sizeof(minUs), stats.minCycles);
+            profileFormatUs(avgUs, sizeof(avgUs), stats.totalCycles / stats.count);
+            profileFormatUs(maxUs, sizeof(maxUs), stats.maxCycles);
+        }
+        if (stats.count > 1) {
+            uint32_t cyclesPerUs = SystemCoreClock / 1000000;
+            snprintf(period, sizeof(period), "%lu - %lu",
+                     (unsigned long)(stats.minPeriod / cyclesPerUs), (unsigned long)(stats.maxPeriod / cyclesPerUs));
+        }
+        TaskHandle_t task = profileSlots[i].task ? *profileSlots[i].task : NULL;
+        if (task) snprintf(stack, sizeof(stack), "%lu", (unsigned long)uxTaskGetStackHighWaterMark(task));
+        else strcpy(stack, "-");
+
+        uint32_t permille = profileWindowCycles ? stats.totalCycles * 1000 / profileWindowCycles : 0;
+        snprintf(line, sizeof(line), "| %s | %lu | %s | %s | %s | %s | %lu.%lu%% | %s |",
+                 profileSlots[i].name, (unsigned long)stats.count, minUs, avgUs, maxUs, period,
+                 (unsigned long)(permille / 10), (unsigned long)(permille % 10), stack);
+        Serial.println(line);
+    }
+
+    uint32_t busyPermille = profileWindowCycles ? busyCycles * 1000 / profileWindowCycles : 0;
+    snprintf(line, sizeof(line), "| **Total** | | | | | | **%lu.%lu%%** | |",
+             (unsigned long)(busyPermille / 10), (unsigned long)(busyPermille % 10));
+    Serial.println(line);
+}
+
+#endif
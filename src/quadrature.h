@@ -0,0 +1,76 @@
+#ifndef QUADRATURE_H
+#define QUADRATURE_H
+
+#include "pin.h"
+
+// -------------------- Quadrature Knob Decoder --------------------
+// The key scanner samples every knob's A/B pair once per millisecond and
+// runs it through a 16-entry transition table, so a fast turn no longer
+// skips states and no direction has to be guessed. Two quarter steps that
+// end on a rest state (00 or 11) make a detent. The gap between detents sets
+// the acceleration: slow turns move one step per detent, a quick flick up to
+// KNOB_ACCEL_MAX, so wide ranges are reachable in one sweep. The scan task
+// collects the accelerated steps every 20 ms.
+const int KNOB_STEPS_PER_DETENT = 2;
+const uint32_t KNOB_ACCEL_MS = 40;      // Detents closer together than this accelerate
+const int KNOB_ACCEL_MAX = 8;
+
+// [previous << 2 | current], state = A | B << 1; forward is 00 -> 01 -> 11 -> 10.
+// Both bits changing at once is a missed state and counts as nothing.
+const int8_t QUADRATURE_TABLE[16] = {
+     0, +1, -1,  0,
+    -1,  0,  0, +1,
+    +1,  0,  0, -1,
+     0, -1, +1,  0
+};
+
+struct KnobDecoder {
+    uint8_t state = 0;
+    int8_t steps = 0;                   // Quarter steps towards the next detent
+    uint32_t lastDetent = 0;            // Scan count of the last detent
+    int32_t detents = 0;                // Signed running total, unaccelerated
+    int32_t pending = 0;                // Accelerated steps not yet collected
+};
+
+KnobDecoder knobDecoders[4];
+
+// Steps a detent is worth, from the ms since the previous one
+inline int knobAcceleration(uint32_t interval) {
+    if (interval >= KNOB_ACCEL_MS) return 1;
+    return std::min<int>(KNOB_ACCEL_MS / std::max<uint32_t>(interval, 1), KNOB_ACCEL_MAX);
+}
+
+// One sample of a knob's A/B pair at scan count `now` (ms)
+void quadratureSample(KnobDecoder& knob, uint32_t ab, uint32_t now) {
+    int8_t step = QUADRATURE_TABLE[knob.state << 2 | ab];
+    knob.state = ab;
+    if (!step) return;
+
+    // Detents rest on 00 and 11; arriving at one short of a full detent
+    // means the knob bounced back, so only the count is cleared
+    knob.steps += step;
+    if (ab != 0b00 && ab != 0b11) return;
+    int steps = knob.steps;
+    knob.steps = 0;
+    if (abs(steps) < KNOB_STEPS_PER_DETENT) return;
+
+    int direction = (steps > 0) ? 1 : -1;
+    int accel = knobAcceleration(now - knob.lastDetent);
+    knob.lastDetent = now;
+    __atomic_add_fetch(&knob.detents, direction, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&knob.pending, direction * accel, __ATOMIC_RELAXED);
+}
+
+// Key scanner, once per full scan: decode every knob from the raw word
+void quadratureScan(uint32_t inputs, uint32_t now) {
+    for (int k = 0; k < 4; k++) {
+        quadratureSample(knobDecoders[k], inputKnob(k)(inputs), now);
+    }
+}
+
+// Scan task: accelerated steps for knob k since the last call
+inline int quadratureCollect(int k) {
+    return __atomic_exchange_n(&knobDecoders[k].pending, 0, __ATOMIC_RELAXED);
+}
+
+#endif
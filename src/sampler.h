@@ -0,0 +1,165 @@
+#ifndef SAMPLER_H
+#define SAMPLER_H
+
+#include "pin.h"
+#include "voices.h"
+#include "bend.h"
+#include "effect.h"
+#include "adpcm.h"
+#include <math.h>
+
+// -------------------- IMA-ADPCM Sample Playback --------------------
+// Recorded samples stay 4:1 compressed in flash and are decoded a block at a
+// time into a shared scratch buffer, then repitched with linear interpolation.
+// A voice only carries its decoder state (predictor, step index, nibble
+// position) plus two decoded samples across blocks. Images are produced by
+// tools/wav2adpcm.cpp; the loop-start decoder state is stored with the image
+// so a sustain loop can jump back without re-decoding from the start.
+struct AdpcmSample {
+    const uint8_t* data;        // Two samples per byte, low nibble first
+    uint32_t length;            // In samples
+    uint32_t sampleRate;
+    float rootFrequency;        // Pitch of the recording in Hz
+    uint32_t loopStart;         // loopEnd == 0: no loop
+    uint32_t loopEnd;
+    int16_t loopPredictor;      // Decoder state just before loopStart
+    uint8_t loopIndex;
+};
+
+// The shipped zones are synthesised placeholders (tools/pianogen.cpp); swap in
+// recordings here
+#include "samples/piano_a3.h"
+#include "samples/piano_a6.h"
+
+// Zones to pick from per note; the closest root in pitch wins
+const AdpcmSample* const samplerZones[] = {&samplePianoA3, &samplePianoA6};
+const int SAMPLER_ZONES = sizeof(samplerZones) / sizeof(samplerZones[0]);
+
+const uint32_t SAMPLER_MAX_STEP = 8 << 16;    // Q16, three octaves above a root
+const int SAMPLER_SCRATCH_SIZE = EFFECT_BLOCK_SIZE * (SAMPLER_MAX_STEP >> 16) + 2;   // Shared by all voices
+const float SAMPLER_ATTACK_TIME = 0.003f;
+const float SAMPLER_RELEASE_TIME = 0.3f;
+const int32_t SAMPLER_LEVEL_ONE = 1 << 15;
+
+struct SamplerVoice {
+    const AdpcmSample* sample;
+    AdpcmDecoder dec;
+    bool looping;               // Held notes stay in the sustain loop
+    bool ended;                 // Ran off the end of a one-shot sample
+    int16_t carry[2];           // Samples at the integer read position and after
+    uint32_t frac;              // Q16 position between carry[0] and carry[1]
+    float baseStep;             // Q16 step before pitch bend
+    uint32_t step;              // Q16, bent, set each block
+    int32_t level;              // Q15 envelope
+    int32_t levelStep;          // Per sample
+};
+
+SamplerVoice samplerVoices[MAX_VOICES];
+int16_t samplerScratch[SAMPLER_SCRATCH_SIZE];
+int32_t samplerAttackStep = 0;
+int32_t samplerReleaseStep = 0;
+
+void samplerInit() {
+    samplerAttackStep = std::max(1, (int)(SAMPLER_LEVEL_ONE / (SAMPLER_ATTACK_TIME * SAMPLE_RATE)));
+    samplerReleaseStep = std::max(1, (int)(SAMPLER_LEVEL_ONE / (SAMPLER_RELEASE_TIME * SAMPLE_RATE)));
+}
+
+// Decode count samples into out, following the sustain loop while it is active
+void samplerDecode(SamplerVoice& v, int16_t* out, int count) {
+    const AdpcmSample& s = *v.sample;
+    AdpcmDecoder& dec = v.dec;
+    for (int i = 0; i < count; i++) {
+        if (v.looping && dec.position == s.loopEnd) {
+            dec.position = s.loopStart;
+            dec.predictor = s.loopPredictor;
+            dec.index = s.loopIndex;
+        }
+        if (dec.position >= s.length) {
+            v.ended = true;
+            out[i] = 0;
+            continue;
+        }
+        uint8_t byte = s.data[dec.position >> 1];
+        out[i] = adpcmDecodeNibble(dec, (dec.position & 1) ? byte >> 4 : byte & 0x0F);
+        dec.position++;
+    }
+}
+
+// Pick the zone whose root needs the least repitching; the played pitch is
+// the one the table voices use for this key, so everything stays in tune
+void samplerStartVoice(int slot, int note) {
+    SamplerVoice& v = samplerVoices[slot];
+    float pitch = notePhases[note] * SAMPLE_RATE;
+    float bestDistance = INFINITY;
+    for (int z = 0; z < SAMPLER_ZONES; z++) {
+        float distance = fabsf(logf(pitch / samplerZones[z]->rootFrequency));
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            v.sample = samplerZones[z];
+        }
+    }
+
+    float ratio = pitch / v.sample->rootFrequency * v.sample->sampleRate / SAMPLE_RATE;
+    v.baseStep = ratio * 65536.0f;
+    v.dec = {0, 0, 0};
+    v.looping = v.sample->loopEnd > v.sample->loopStart;
+    v.ended = false;
+    v.frac = 0;
+    samplerDecode(v, v.carry, 2);
+    v.level = 0;
+    v.levelStep = samplerAttackStep;
+}
+
+void samplerReleaseVoice(int slot) {
+    samplerVoices[slot].looping = false;
+    samplerVoices[slot].levelStep = -samplerReleaseStep;
+}
+
+// Accumulates one voice into the block; returns false once it has finished
+bool samplerRenderVoice(SamplerVoice& v, float* block, int length, float gain) {
+    // carry[0..1] plus every sample the block steps over
+    uint32_t advance = (v.frac + v.step * length) >> 16;
+    int16_t* s = samplerScratch;
+    s[0] = v.carry[0];
+    s[1] = v.carry[1];
+    samplerDecode(v, s + 2, advance);
+
+    uint32_t acc = v.frac;
+    int32_t level = v.level;
+    for (int n = 0; n < length; n++) {
+        uint32_t i = acc >> 16;
+        int32_t x = s[i] + (((s[i + 1] - s[i]) * (int32_t)((acc & 0xFFFF) >> 2)) >> 14);
+        level = constrain(level + v.levelStep, 0, SAMPLER_LEVEL_ONE);
+        // Offset by the envelope so the unipolar output returns to zero
+        block[n] += ((x * level >> 15) + level) * gain;
+        acc += v.step;
+    }
+
+    v.carry[0] = s[advance];
+    v.carry[1] = s[advance + 1];
+    v.frac = acc & 0xFFFF;
+    v.level = level;
+    // A one-shot that ran out fades its offset instead of dropping it
+    if (v.ended && v.levelStep > 0) v.levelStep = -samplerReleaseStep;
+    return level > 0;
+}
+
+// Called once per block; returns true while any sample is playing
+bool samplerRenderBlock(float* block, int length, int volume) {
+    voicePoolScan(samplerStartVoice, samplerReleaseVoice);
+
+    memset(block, 0, length * sizeof(float));
+    int sounding = voicesSounding();
+    if (sounding == 0) return false;
+
+    float gain = ldexpf(255.0f, volume - 8) / (65536.0f * sounding);
+    for (int v = 0; v < MAX_VOICES; v++) {
+        if (voicePool.slots[v].note < 0) continue;
+        SamplerVoice& voice = samplerVoices[v];
+        voice.step = (uint32_t)std::min(voice.baseStep * pitchBendRatio, (float)SAMPLER_MAX_STEP);
+        if (!samplerRenderVoice(voice, block, length, gain)) voiceFree(v);
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,351 @@
+// Synthesised placeholder, not a recording: generated by tools/pianogen.cpp
+//   ./pianogen PianoA3 220 0.5 8800 10800
+// 11000 samples at 22000 Hz, root 220.00 Hz, loop 8800..10800, 5500 bytes
+const uint8_t samplePianoA3Data[5500] = {
+    0x70,0x77,0x77,0x67,0x11,0x10,0x10,0x11,0x21,0x00,0x00,0x11,0x01,0x98,0xCB,0xAB,
+    0xBA,0xDD,0xCC,0xCB,0xAA,0xDB,0xDB,0xBB,0xBB,0xCA,0xCB,0xBC,0xBA,0xBA,0xCB,0xBC,
+    0xAC,0xAA,0xB9,0xDB,0xBB,0x9A,0x98,0xB9,0xBD,0x19,0x63,0x23,0x00,0x73,0x77,0x45,
+    0x23,0x13,0x01,0x80,0x00,0x10,0x80,0x98,0x98,0x88,0x98,0xB9,0xCB,0xAA,0xAA,0xCC,
+    0xAC,0xBB,0xBB,0xDB,0xBC,0xCB,0xAA,0xBB,0xBD,0xCB,0xAB,0xBB,0xBC,0xAD,0xBB,0xBA,
+    0xCB,0xDB,0xBA,0xAA,0xAA,0xBC,0xAC,0x9A,0x98,0xB9,0xBB,0x29,0x46,0x24,0x21,0x74,
+    0x47,0x35,0x25,0x22,0x10,0x08,0x00,0x01,0x80,0x88,0x98,0x80,0x99,0xA9,0xBB,0xBB,
+    0xCB,0xDB,0xBC,0xBB,0xBB,0xCC,0xCB,0xCB,0xAA,0xCB,0xBB,0xBC,0xAC,0xBA,0xBC,0xCB,
+    0xBB,0xBA,0xBC,0xBC,0xBB,0xBB,0xBB,0xBD,0xAC,0x9A,0x89,0xA9,0xAB,0x28,0x47,0x33,
+    0x33,0x67,0x55,0x44,0x33,0x23,0x11,0x10,0x00,0x01,0x81,0x88,0x98,0x88,0xA8,0xBA,
+    0xBC,0xBB,0xDB,0xCB,0xBC,0xBB,0xCB,0xBC,0xCB,0xAC,0xAB,0xAC,0xAC,0xAC,0xBA,0xBB,
+    0xBC,0xBC,0xBB,0xBB,0xBC,0xBC,0xAC,0xBA,0xBA,0xCB,0xBB,0xAA,0x99,0xA9,0xAA,0x40,
+    0x56,0x33,0x34,0x56,0x55,0x44,0x33,0x23,0x11,0x01,0x11,0x10,0x00,0x88,0x88,0x98,
+    0xA8,0xBA,0xBC,0xBB,0xBC,0xCC,0xAC,0xAC,0xBA,0xCB,0xBC,0xBB,0xAC,0xAC,0xCB,0xBB,
+    0xAC,0xBB,0xBC,0xAC,0xBB,0xAC,0xBB,0xBC,0xBB,0xBB,0xCB,0xCB,0xBA,0x9A,0x99,0xA9,
+    0x89,0x41,0x56,0x43,0x43,0x64,0x54,0x44,0x33,0x32,0x21,0x01,0x11,0x10,0x01,0x88,
+    0x88,0x88,0x99,0xBB,0xDB,0xBA,0xBC,0xDB,0xCB,0xBB,0xCB,0xCB,0xCB,0xBB,0xBC,0xBB,
+    0xBD,0xBB,0xBC,0xBB,0xBC,0xBC,0xCB,0xBA,0xBB,0xBC,0xAC,0xAB,0xBA,0xCB,0xAB,0xAA,
+    0x99,0x98,0x09,0x61,0x45,0x53,0x43,0x54,0x45,0x34,0x34,0x33,0x12,0x11,0x11,0x11,
+    0x00,0x80,0x88,0x88,0xA8,0xBA,0xBC,0xBC,0xCB,0xDB,0xBB,0xBC,0xCB,0xCB,0xCB,0xBB,
+    0xCB,0xCB,0xBB,0xBC,0xCB,0xBB,0xCB,0xCB,0xBB,0xBB,0xDB,0xBA,0xAC,0xBA,0xBA,0xBB,
+    0xCB,0x9A,0x89,0x89,0x08,0x63,0x54,0x34,0x44,0x44,0x45,0x44,0x33,0x32,0x22,0x11,
+    0x21,0x11,0x10,0x08,0x88,0x88,0x99,0xBA,0xBC,0xBC,0xBC,0xBC,0xBC,0xBC,0xCB,0xCB,
+    0xBB,0xBC,0xAC,0xAC,0xBB,0xBC,0xCB,0xBA,0xBC,0xBB,0xBC,0xBB,0xAC,0xAC,0xBB,0xAB,
+    0xCB,0xBA,0xAB,0xAA,0x99,0x88,0x10,0x54,0x55,0x43,0x34,0x36,0x55,0x43,0x43,0x22,
+    0x12,0x12,0x11,0x01,0x01,0x00,0x08,0x88,0x99,0xAA,0xCB,0xCB,0xCB,0xCB,0xCB,0xAC,
+    0xBB,0xBC,0xBC,0xCB,0xCB,0xBA,0xBC,0xCB,0xAB,0xBC,0xCA,0xBB,0xBB,0xBC,0xBB,0xBC,
+    0xAC,0xBA,0xBA,0xBB,0xAC,0xA9,0x98,0x08,0x20,0x54,0x45,0x53,0x53,0x44,0x44,0x53,
+    0x33,0x33,0x32,0x21,0x21,0x12,0x01,0x01,0x88,0x90,0xA8,0xBA,0xBD,0xCB,0xCB,0xBC,
+    0xDB,0xBB,0xCB,0xCB,0xCB,0xBB,0xBC,0xCB,0xCB,0xBB,0xCB,0xBB,0xBC,0xCB,0xAB,0xAC,
+    0xBB,0xCB,0xBB,0xBB,0xBB,0xCB,0xAB,0x9A,0x99,0x00,0x30,0x65,0x44,0x53,0x53,0x34,
+    0x36,0x44,0x33,0x24,0x12,0x12,0x11,0x11,0x11,0x00,0x80,0x88,0x98,0xAA,0xCB,0xCB,
+    0xCB,0xCB,0xBC,0xCB,0xCB,0xBB,0xBC,0xBC,0xBB,0xAD,0xCB,0xBB,0xCB,0xBB,0xCB,0xAC,
+    0xBB,0xBB,0xBC,0xCB,0xAB,0xBB,0xBB,0xAC,0xAB,0x9A,0x98,0x00,0x31,0x56,0x44,0x53,
+    0x34,0x54,0x53,0x34,0x24,0x33,0x22,0x21,0x12,0x12,0x11,0x10,0x08,0x88,0x98,0xBA,
+    0xBC,0xBC,0xBC,0xCC,0xCB,0xBB,0xBC,0xCB,0xBC,0xBB,0xBC,0xBC,0xCB,0xBB,0xBC,0xCB,
+    0xBB,0xCB,0xBB,0xBC,0xCA,0xBA,0xBB,0xBB,0xCB,0xBA,0xBA,0x9A,0x98,0x10,0x32,0x47,
+    0x54,0x43,0x44,0x53,0x44,0x43,0x24,0x23,0x22,0x22,0x21,0x11,0x02,0x01,0x00,0x88,
+    0x98,0xBA,0xCB,0xBC,0xBC,0xCC,0xBB,0xBC,0xBC,0xCB,0xBC,0xBB,0xBC,0xBC,0xBB,0xAD,
+    0xBB,0xBC,0xBB,0xBC,0xAC,0xBB,0xCB,0xBA,0xAC,0xBA,0xBA,0xBA,0xAB,0xAA,0x88,0x10,
+    0x52,0x54,0x35,0x35,0x35,0x44,0x44,0x34,0x43,0x23,0x23,0x22,0x12,0x12,0x12,0x10,
+    0x80,0x80,0x98,0xBA,0xBC,0xBC,0xCC,0xCB,0xCB,0xBB,0xCC,0xCA,0xBA,0xBC,0xBB,0xBC,
+    0xBC,0xCB,0xCA,0xBA,0xBB,0xBC,0xCB,0xAB,0xAC,0xBB,0xBB,0xBB,0xAC,0xAB,0xAB,0x9A,
+    0x09,0x10,0x53,0x54,0x35,0x35,0x44,0x44,0x53,0x53,0x32,0x33,0x23,0x22,0x22,0x12,
+    0x12,0x01,0x01,0x88,0x98,0xBA,0xCC,0xBB,0xBD,0xDB,0xCB,0xBB,0xCC,0xBA,0xBC,0xCB,
+    0xCB,0xCA,0xBA,0xCB,0xBB,0xCB,0xBB,0xBC,0xBB,0xBC,0xBB,0xBC,0xBB,0xBB,0xAC,0xAB,
+    0xBA,0x99,0x09,0x20,0x53,0x64,0x53,0x34,0x44,0x34,0x45,0x43,0x43,0x32,0x22,0x12,
+    0x22,0x21,0x11,0x11,0x00,0x88,0x98,0xB9,0xCB,0xBC,0xBC,0xCC,0xBB,0xAD,0xAC,0xCB,
+    0xBB,0xDB,0xBA,0xBC,0xBB,0xBC,0xAC,0xCB,0xBA,0xAC,0xBB,0xCB,0xBB,0xBB,0xBC,0xBA,
+    0xBB,0xBB,0xAB,0x9A,0x09,0x21,0x73,0x44,0x54,0x43,0x34,0x35,0x35,0x35,0x43,0x23,
+    0x23,0x22,0x22,0x12,0x12,0x01,0x01,0x08,0x99,0xB9,0xDB,0xCB,0xCB,0xBC,0xBC,0xDB,
+    0xBB,0xCB,0xBC,0xCB,0xBB,0xBC,0xCB,0xBB,0xBC,0xAC,0xBB,0xBC,0xBB,0xBC,0xBB,0xCB,
+    0xBB,0xBB,0xBB,0xBB,0xAC,0x99,0x08,0x11,0x34,0x46,0x35,0x35,0x44,0x53,0x34,0x44,
+    0x33,0x43,0x22,0x21,0x12,0x22,0x11,0x01,0x81,0x00,0x98,0xAA,0xCB,0xCB,0xBC,0xBC,
+    0xAD,0xAC,0xCB,0xBB,0xBC,0xBC,0xBB,0xAD,0xCB,0xBB,0xCB,0xBB,0xCB,0xCB,0xBB,0xBB,
+    0xBC,0xBB,0xCB,0xAB,0xBB,0xBA,0xAB,0x9A,0x08,0x21,0x54,0x54,0x44,0x53,0x43,0x44,
+    0x53,0x43,0x43,0x32,0x22,0x22,0x22,0x12,0x12,0x11,0x00,0x80,0x88,0xAA,0xBC,0xDB,
+    0xCB,0xDB,0xBB,0xBC,0xBC,0xCB,0xBC,0xBB,0xBC,0xBC,0xCB,0xBB,0xBC,0xCB,0xBB,0xCB,
+    0xBB,0xBC,0xCA,0xBA,0xBA,0xBB,0xBB,0xBB,0xBB,0x99,0x08,0x31,0x54,0x45,0x35,0x44,
+    0x34,0x44,0x44,0x43,0x33,0x24,0x32,0x21,0x22,0x22,0x11,0x11,0x00,0x00,0x98,0xB9,
+    0xCB,0xBC,0xBC,0xCC,0xCB,0xBB,0xAD,0xCB,0xCB,0xCA,0xBA,0xCB,0xBB,0xBC,0xCB,0xBB,
+    0xCB,0xCB,0xBA,0xCB,0xBA,0xBB,0xAC,0xAB,0xAB,0xBB,0xAA,0x9A,0x00,0x21,0x45,0x54,
+    0x44,0x43,0x44,0x43,0x35,0x34,0x34,0x33,0x23,0x23,0x22,0x23,0x12,0x02,0x01,0x00,
+    0x98,0xBA,0xDB,0xBC,0xBC,0xCC,0xCB,0xBB,0xBC,0xBC,0xBC,0xAC,0xAC,0xBB,0xBC,0xCB,
+    0xBB,0xCB,0xCB,0xBB,0xBB,0xBC,0xBB,0xBC,0xBB,0xBB,0xCB,0xAA,0xAA,0x8A,0x08,0x31,
+    0x44,0x45,0x44,0x44,0x43,0x53,0x34,0x35,0x43,0x32,0x32,0x22,0x22,0x21,0x22,0x01,
+    0x01,0x00,0x98,0xAA,0xDB,0xCB,0xCB,0xBC,0xBC,0xBC,0xDB,0xCA,0xBA,0xBC,0xBB,0xBC,
+    0xBC,0xCB,0xBB,0xCB,0xBB,0xBC,0xCB,0xBA,0xCB,0xAB,0xBB,0xBB,0xAC,0xAA,0xAA,0x8A,
+    0x18,0x21,0x44,0x45,0x44,0x34,0x35,0x44,0x53,0x53,0x32,0x33,0x23,0x32,0x22,0x22,
+    0x22,0x11,0x01,0x00,0x98,0xAA,0xBC,0xBD,0xDB,0xCB,0xCB,0xAC,0xAC,0xCB,0xBB,0xBC,
+    0xCB,0xCB,0xBB,0xCB,0xAC,0xBB,0xCB,0xBB,0xBC,0xBB,0xCB,0xBB,0xBB,0xAC,0xAB,0xBA,
+    0xAA,0x8A,0x18,0x31,0x54,0x54,0x34,0x35,0x35,0x34,0x45,0x43,0x24,0x23,0x32,0x22,
+    0x31,0x21,0x12,0x02,0x01,0x00,0x98,0xB9,0xCB,0xBC,0xBC,0xBD,0xBC,0xBC,0xCB,0xCB,
+    0xCB,0xCB,0xBA,0xBC,0xBB,0xBC,0xBC,0xBB,0xBC,0xCB,0xBB,0xBB,0xBC,0xCB,0xBA,0xAB,
+    0xBB,0xBA,0xAB,0x99,0x00,0x32,0x64,0x44,0x44,0x34,0x44,0x53,0x34,0x44,0x42,0x22,
+    0x22,0x12,0x22,0x12,0x12,0x11,0x00,0x00,0x98,0xA9,0xCA,0xCB,0xBC,0xBC,0xCC,0xBB,
+    0xBC,0xBC,0xDB,0xBA,0xAC,0xAC,0xBB,0xBC,0xBB,0xBC,0xCB,0xBB,0xCB,0xBB,0xCB,0xBB,
+    0xBB,0xAC,0xBA,0xBA,0xAA,0x89,0x18,0x31,0x54,0x54,0x34,0x35,0x44,0x53,0x53,0x43,
+    0x43,0x32,0x22,0x22,0x22,0x21,0x12,0x11,0x01,0x00,0x88,0xAA,0xCB,0xBC,0xBC,0xBD,
+    0xDB,0xBB,0xBC,0xDB,0xBB,0xBC,0xCB,0xBB,0xBC,0xAC,0xAC,0xBB,0xCB,0xBB,0xCB,0xBB,
+    0xCB,0xBB,0xBB,0xBB,0xCB,0xBA,0x9A,0x8A,0x18,0x31,0x54,0x54,0x34,0x35,0x44,0x53,
+    0x53,0x43,0x33,0x24,0x32,0x21,0x22,0x22,0x12,0x11,0x10,0x80,0x90,0xA9,0xCB,0xBC,
+    0xBC,0xBD,0xDB,0xBB,0xDB,0xBB,0xBC,0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xBC,0xCB,0xCA,
+    0xBA,0xBB,0xBB,0xBC,0xCB,0xAA,0xBA,0xAA,0x9B,0x8A,0x00,0x22,0x54,0x54,0x34,0x35,
+    0x44,0x43,0x35,0x34,0x34,0x33,0x23,0x23,0x23,0x32,0x22,0x11,0x01,0x00,0x88,0xBA,
+    0xDB,0xBC,0xBC,0xCC,0xCB,0xCB,0xBB,0xBC,0xBC,0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xDB,
+    0xBA,0xAC,0xBB,0xBB,0xBC,0xBB,0xCB,0xBA,0xAB,0xAB,0xAB,0x89,0x18,0x31,0x55,0x44,
+    0x44,0x53,0x43,0x34,0x45,0x33,0x25,0x33,0x32,0x22,0x22,0x22,0x12,0x12,0x10,0x80,
+    0x90,0xAA,0xCB,0xCC,0xBB,0xBD,0xCC,0xCA,0xBA,0xBC,0xCB,0xAC,0xBB,0xBC,0xAC,0xAC,
+    0xBB,0xCB,0xBB,0xCB,0xBB,0xBC,0xCA,0xBA,0xBA,0xBB,0xAB,0xBB,0xAB,0x99,0x18,0x32,
+    0x46,0x44,0x35,0x35,0x44,0x43,0x44,0x34,0x43,0x32,0x32,0x22,0x22,0x22,0x22,0x11,
+    0x10,0x00,0x98,0xB9,0xCB,0xBC,0xCC,0xCB,0xBC,0xCB,0xAC,0xAC,0xCB,0xBB,0xBC,0xBB,
+    0xBD,0xBB,0xBC,0xBB,0xAD,0xBB,0xAC,0xBB,0xCB,0xBA,0xCB,0xAA,0xBA,0xAA,0xAA,0x89,
+    0x00,0x31,0x54,0x54,0x53,0x34,0x34,0x35,0x35,0x35,0x43,0x32,0x32,0x22,0x22,0x22,
+    0x22,0x11,0x10,0x80,0x90,0xB9,0xCB,0xBC,0xCC,0xCB,0xBC,0xCB,0xCB,0xCB,0xBB,0xCC,
+    0xBA,0xCB,0xBB,0xBC,0xAC,0xCB,0xBA,0xCB,0xBA,0xCB,0xBA,0xBB,0xAC,0xAB,0xAB,0xAB,
+    0xAA,0x99,0x00,0x32,0x45,0x45,0x44,0x53,0x43,0x53,0x34,0x35,0x43,0x32,0x22,0x23,
+    0x22,0x22,0x21,0x11,0x01,0x00,0x88,0xAA,0xDB,0xBB,0xBD,0xCC,0xCB,0xBB,0xCC,0xCA,
+    0xBB,0xCB,0xCB,0xBB,0xBC,0xCB,0xBB,0xBC,0xBB,0xBC,0xAC,0xBB,0xCB,0xBA,0xBB,0xBB,
+    0xAC,0xAA,0xAA,0x89,0x18,0x31,0x54,0x44,0x35,0x35,0x34,0x35,0x35,0x44,0x33,0x24,
+    0x22,0x22,0x21,0x22,0x21,0x01,0x01,0x00,0x88,0xA9,0xCB,0xCB,0xBC,0xCC,0xCB,0xBB,
+    0xBC,0xCC,0xBA,0xBC,0xCB,0xBB,0xDB,0xCA,0xBA,0xCA,0xBA,0xCB,0xBA,0xBB,0xBC,0xBB,
+    0xBB,0xAC,0xAB,0xAB,0x9B,0x8A,0x00,0x32,0x45,0x45,0x34,0x45,0x43,0x53,0x34,0x44,
+    0x33,0x33,0x33,0x23,0x33,0x32,0x22,0x21,0x10,0x00,0x88,0xBA,0xBC,0xBD,0xCC,0xCB,
+    0xBC,0xCB,0xCB,0xBB,0xAD,0xAC,0xBB,0xBC,0xCB,0xBB,0xBC,0xBB,0xCC,0xBA,0xBB,0xCB,
+    0xBB,0xBB,0xBC,0xAB,0xBB,0xBA,0xAB,0x99,0x10,0x32,0x55,0x44,0x35,0x44,0x53,0x43,
+    0x44,0x43,0x24,0x23,0x23,0x22,0x22,0x22,0x12,0x11,0x01,0x00,0x90,0xB9,0xCB,0xDB,
+    0xCB,0xBC,0xBC,0xBC,0xDB,0xCA,0xCA,0xBA,0xCB,0xBB,0xDB,0xBA,0xAC,0xBB,0xBC,0xBB,
+    0xBC,0xBB,0xCB,0xBB,0xCB,0xBA,0xBA,0xAA,0x9B,0x8A,0x00,0x32,0x64,0x63,0x53,0x34,
+    0x53,0x34,0x54,0x33,0x44,0x22,0x22,0x22,0x12,0x22,0x21,0x01,0x01,0x00,0x88,0xA9,
+    0xCB,0xCB,0xDB,0xCB,0xDB,0xBA,0xBC,0xCB,0xAC,0xAC,0xBB,0xBC,0xCB,0xBB,0xBC,0xBB,
+    0xBC,0xAC,0xBB,0xAC,0xBB,0xAC,0xAB,0xBB,0xBA,0xBB,0xAA,0x8A,0x00,0x42,0x63,0x44,
+    0x35,0x44,0x53,0x43,0x44,0x43,0x43,0x23,0x32,0x12,0x13,0x13,0x22,0x11,0x10,0x00,
+    0x98,0xA9,0xCB,0xBC,0xCC,0xCB,0xCB,0xAC,0xAC,0xCB,0xBB,0xBC,0xBC,0xBB,0xCC,0xBA,
+    0xAC,0xBB,0xBC,0xBB,0xCB,0xCB,0xBA,0xBB,0xBB,0xAC,0xBA,0xBA,0xAA,0x89,0x18,0x22,
+    0x45,0x45,0x34,0x35,0x35,0x34,0x45,0x43,0x24,0x23,0x23,0x22,0x31,0x21,0x22,0x11,
+    0x10,0x00,0x98,0xA9,0xCB,0xBC,0xCC,0xCB,0xCB,0xCB,0xCB,0xCB,0xBB,0xBC,0xCB,0xCB,
+    0xBB,0xBC,0xCB,0xBB,0xCB,0xBB,0xBC,0xBB,0xCB,0xBB,0xCB,0xBA,0xAA,0xAB,0xAA,0x99,
+    0x10,0x31,0x45,0x45,0x63,0x43,0x43,0x44,0x53,0x43,0x24,0x23,0x32,0x12,0x13,0x22,
+    0x22,0x11,0x10,0x00,0x98,0xA9,0xCB,0xBC,0xCC,0xCB,0xCB,0xCB,0xCB,0xBB,0xAD,0xAC,
+    0xBB,0xAC,0xAC,0xCB,0xBA,0xCB,0xBB,0xCB,0xBB,0xCB,0xBA,0xAC,0xBB,0xBA,0xBA,0xBB,
+    0xAA,0x99,0x10,0x41,0x63,0x44,0x35,0x44,0x43,0x44,0x53,0x43,0x24,0x23,0x32,0x12,
+    0x13,0x22,0x22,0x11,0x10,0x80,0x90,0xA9,0xCB,0xBC,0xBC,0xBD,0xBC,0xBC,0xCB,0xAC,
+    0xBC,0xBB,0xBC,0xCB,0xAC,0xCB,0xBA,0xCB,0xCA,0xBA,0xBB,0xBB,0xBC,0xCB,0xAB,0xAB,
+    0xBB,0xBA,0xAB,0x89,0x18,0x32,0x55,0x44,0x44,0x34,0x44,0x34,0x44,0x34,0x34,0x32,
+    0x23,0x23,0x22,0x22,0x22,0x11,0x11,0x00,0x98,0xA9,0xBC,0xCC,0xCB,0xDB,0xBB,0xCC,
+    0xCA,0xCA,0xBA,0xBC,0xBB,0xBC,0xBC,0xCB,0xBB,0xCB,0xCB,0xBA,0xAC,0xBB,0xBB,0xCB,
+    0xBB,0xBB,0xBB,0xBB,0xAB,0x99,0x10,0x32,0x46,0x35,0x36,0x44,0x43,0x44,0x53,0x43,
+    0x24,0x23,0x22,0x22,0x22,0x13,0x22,0x01,0x11,0x80,0x90,0xA9,0xCB,0xBC,0xBC,0xBD,
+    0xBC,0xBC,0xCB,0xCB,0xAC,0xCB,0xBB,0xCB,0xCB,0xBB,0xBC,0xBB,0xBC,0xCB,0xBB,0xCB,
+    0xBB,0xBB,0xAC,0xBB,0xBA,0xAB,0xAB,0x89,0x18,0x32,0x55,0x44,0x44,0x34,0x44,0x53,
+    0x34,0x44,0x33,0x33,0x23,0x23,0x23,0x23,0x22,0x21,0x10,0x00,0x88,0xBA,0xDB,0xBC,
+    0xBC,0xBD,0xBC,0xDB,0xBB,0xDB,0xBB,0xBC,0xCB,0xCB,0xBB,0xBC,0xBB,0xBC,0xBC,0xBB,
+    0xCB,0xBB,0xAC,0xBB,0xCB,0xBA,0xAA,0xAB,0xAA,0x89,0x18,0x22,0x45,0x54,0x34,0x35,
+    0x44,0x34,0x44,0x34,0x34,0x32,0x23,0x22,0x23,0x22,0x22,0x11,0x01,0x00,0x88,0xAA,
+    0xDB,0xCB,0xBC,0xBC,0xCC,0xBB,0xBC,0xBC,0xBC,0xCB,0xBB,0xBC,0xBC,0xCB,0xBB,0xCB,
+    0xBB,0xBC,0xCB,0xBA,0xCB,0xBA,0xBB,0xBB,0xAB,0xAC,0x9A,0x89,0x18,0x31,0x44,0x45,
+    0x44,0x34,0x44,0x53,0x34,0x44,0x33,0x33,0x32,0x23,0x23,0x32,0x22,0x11,0x11,0x00,
+    0x88,0xBA,0xDB,0xBC,0xBC,0xBD,0xBC,0xDB,0xCA,0xCA,0xBA,0xAC,0xAC,0xBB,0xBC,0xBB,
+    0xBC,0xBC,0xBB,0xBC,0xBB,0xBC,0xBB,0xAC,0xBB,0xBB,0xBB,0xBB,0xAB,0x99,0x00,0x33,
+    0x46,0x54,0x34,0x35,0x44,0x53,0x53,0x43,0x24,0x23,0x22,0x22,0x22,0x22,0x12,0x11,
+    0x01,0x00,0x88,0xA9,0xAC,0xBC,0xBC,0xBD,0xBC,0xDB,0xBB,0xDB,0xBB,0xBC,0xCB,0xCB,
+    0xBB,0xDB,0xBA,0xCB,0xBA,0xAC,0xBB,0xAC,0xBB,0xBB,0xBC,0xBA,0xBA,0xAB,0xAB,0x99,
+    0x10,0x32,0x45,0x45,0x44,0x34,0x44,0x53,0x53,0x43,0x43,0x32,0x22,0x22,0x22,0x22,
+    0x12,0x11,0x01,0x00,0x88,0xAA,0xCB,0xDB,0xCB,0xCB,0xBC,0xBC,0xCB,0xCB,0xAC,0xCB,
+    0xBB,0xCB,0xCB,0xBB,0xCB,0xCB,0xAB,0xBC,0xBA,0xAC,0xBB,0xBB,0xBC,0xBA,0xBA,0xAB,
+    0xAB,0x89,0x18,0x32,0x45,0x45,0x44,0x34,0x44,0x53,0x53,0x43,0x43,0x32,0x22,0x22,
+    0x22,0x22,0x12,0x11,0x10,0x00,0x88,0xAA,0xCB,0xDB,0xCB,0xDB,0xBB,0xBC,0xBC,0xBC,
+    0xBC,0xCB,0xBB,0xBC,0xBC,0xCB,0xBB,0xCB,0xBB,0xBC,0xCB,0xBA,0xBB,0xBC,0xBA,0xBB,
+    0xBB,0xBB,0xAB,0x8A,0x00,0x42,0x44,0x45,0x44,0x34,0x44,0x53,0x53,0x43,0x43,0x32,
+    0x22,0x22,0x22,0x22,0x21,0x11,0x10,0x00,0x98,0xA9,0xCB,0xDB,0xCB,0xDB,0xBB,0xBC,
+    0xBC,0xBC,0xBC,0xCB,0xBB,0xBC,0xBC,0xCB,0xBB,0xCB,0xBB,0xBC,0xBB,0xBC,0xBB,0xAC,
+    0xBB,0xBB,0xBB,0xBB,0xAB,0x99,0x10,0x32,0x55,0x35,0x36,0x44,0x43,0x34,0x45,0x43,
+    0x43,0x32,0x22,0x22,0x22,0x22,0x21,0x01,0x11,0x80,0x90,0xA9,0xCB,0xBC,0xBC,0xCC,
+    0xCB,0xAC,0xCB,0xBB,0xCC,0xBA,0xBC,0xBB,0xBC,0xBC,0xBB,0xBC,0xAC,0xCB,0xBA,0xBB,
+    0xCB,0xBB,0xBB,0xAC,0xBA,0xAA,0xAA,0x99,0x00,0x32,0x54,0x54,0x34,0x35,0x44,0x53,
+    0x53,0x43,0x43,0x32,0x22,0x22,0x22,0x22,0x21,0x01,0x01,0x81,0x90,0xA9,0xCB,0xBC,
+    0xBC,0xCC,0xCB,0xCB,0xCB,0xBB,0xBC,0xBC,0xAC,0xAC,0xBB,0xBC,0xBB,0xBC,0xAC,0xCB,
+    0xBA,0xBB,0xCB,0xBB,0xBB,0xCB,0xAA,0xAB,0xAA,0x89,0x18,0x31,0x54,0x35,0x36,0x44,
+    0x43,0x34,0x45,0x43,0x43,0x32,0x22,0x22,0x22,0x12,0x12,0x02,0x01,0x81,0x90,0xA9,
+    0xCB,0xBC,0xBC,0xCC,0xCB,0xCB,0xCB,0xBB,0xBC,0xBC,0xAC,0xAC,0xBB,0xBC,0xBB,0xBC,
+    0xCB,0xCB,0xBA,0xBB,0xCB,0xBB,0xBB,0xBB,0xAC,0xBA,0xAA,0x89,0x00,0x22,0x45,0x54,
+    0x34,0x35,0x44,0x53,0x53,0x43,0x43,0x32,0x22,0x22,0x22,0x12,0x12,0x02,0x01,0x81,
+    0x88,0xA9,0xCB,0xBC,0xBC,0xCC,0xCB,0xCB,0xCB,0xBB,0xBC,0xBC,0xAC,0xCB,0xBB,0xBC,
+    0xBB,0xBC,0xCB,0xBB,0xBC,0xCA,0xBA,0xBA,0xAC,0xBA,0xAA,0xAB,0xAA,0x89,0x18,0x31,
+    0x45,0x54,0x34,0x35,0x44,0x53,0x53,0x43,0x43,0x32,0x22,0x22,0x22,0x21,0x12,0x02,
+    0x01,0x00,0x90,0xA9,0xCB,0xBC,0xBC,0xCC,0xCB,0xCB,0xCB,0xBB,0xBC,0xBC,0xAC,0xCB,
+    0xBB,0xBC,0xBB,0xBC,0xCB,0xBB,0xBC,0xBA,0xAC,0xBB,0xAC,0xBA,0xAA,0xAB,0xAA,0x89,
+    0x18,0x22,0x45,0x54,0x34,0x35,0x44,0x53,0x53,0x43,0x43,0x32,0x22,0x22,0x12,0x22,
+    0x12,0x02,0x01,0x81,0x90,0xA9,0xCB,0xBC,0xBC,0xCC,0xCB,0xCB,0xCB,0xBB,0xBC,0xBC,
+    0xAC,0xCB,0xBB,0xAC,0xAC,0xBB,0xCB,0xBB,0xBC,0xBA,0xBC,0xBA,0xCB,0xAA,0xAB,0xBA,
+    0xAA,0x89,0x00,0x22,0x45,0x54,0x34,0x35,0x44,0x53,0x53,0x43,0x43,0x32,0x22,0x22,
+    0x12,0x22,0x12,0x11,0x01,0x00,0x90,0xA9,0xCB,0xBC,0xBC,0xCC,0xCB,0xCB,0xCB,0xBB,
+    0xBC,0xBC,0xCB,0xCB,0xBB,0xCB,0xCB,0xBB,0xCB,0xBB,0xAC,0xBB,0xAC,0xBB,0xCB,0xAA,
+    0xAB,0xBA,0x9A,0x8A,0x00,0x32,0x54,0x54,0x34,0x35,0x44,0x53,0x53,0x43,0x43,0x32,
+    0x22,0x22,0x12,0x22,0x12,0x11,0x01,0x00,0x88,0xA9,0xCB,0xBC,0xBC,0xCC,0xCB,0xCB,
+    0xCB,0xBB,0xBC,0xBC,0xCB,0xCB,0xBB,0xCB,0xCB,0xBB,0xCB,0xBB,0xCB,0xBB,0xCB,0xBB,
+    0xBB,0xAC,0xBA,0xAA,0xAA,0x99,0x00,0x32,0x54,0x54,0x34,0x35,0x44,0x53,0x53,0x43,
+    0x43,0x32,0x22,0x22,0x12,0x22,0x12,0x11,0x01,0x00,0x88,0xA9,0xAC,0xBC,0xBC,0xBD,
+    0xDB,0xBB,0xBC,0xBC,0xCB,0xAC,0xCB,0xBB,0xCB,0xCB,0xBB,0xCB,0xBB,0xBC,0xBB,0xBC,
+    0xBB,0xCB,0xBB,0xBB,0xAB,0xBB,0xAB,0x8A,0x18,0x32,0x46,0x54,0x34,0x35,0x44,0x53,
+    0x53,0x43,0x43,0x32,0x22,0x22,0x21,0x22,0x12,0x11,0x01,0x00,0x90,0xA9,0xCB,0xBC,
+    0xBC,0xCC,0xCB,0xCB,0xCB,0xBB,0xBC,0xBC,0xCB,0xCB,0xBB,0xCB,0xCB,0xBB,0xCB,0xBB,
+    0xCB,0xBB,0xCB,0xBB,0xBB,0xCB,0xAA,0xAB,0xAA,0x89,0x18,0x31,0x54,0x54,0x34,0x35,
+    0x44,0x53,0x53,0x43,0x43,0x32,0x22,0x22,0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xA9,
+    0xCB,0xBC,0xBC,0xCC,0xCB,0xCB,0xCB,0xBB,0xBC,0xBC,0xCB,0xCB,0xBB,0xCB,0xCB,0xBB,
+    0xCB,0xBB,0xCB,0xBB,0xCB,0xBB,0xBB,0xCB,0xAA,0xAB,0xAA,0x89,0x18,0x31,0x45,0x54,
+    0x53,0x34,0x44,0x53,0x53,0x43,0x43,0x32,0x22,0x22,0x21,0x22,0x12,0x11,0x01,0x00,
+    0x88,0xA9,0xCB,0xBC,0xBC,0xCC,0xCB,0xCB,0xCB,0xBB,0xBC,0xBC,0xCB,0xCB,0xBB,0xCB,
+    0xCB,0xAB,0xBC,0xCA,0xBA,0xBB,0xCB,0xBB,0xBB,0xBB,0xAC,0xBA,0xAA,0x89,0x18,0x22,
+    0x45,0x54,0x53,0x34,0x44,0x53,0x53,0x43,0x43,0x32,0x22,0x22,0x21,0x22,0x12,0x11,
+    0x01,0x00,0x88,0xA9,0xAC,0xBC,0xBC,0xBD,0xDB,0xBB,0xBC,0xDB,0xBB,0xBC,0xCB,0xBB,
+    0xBC,0xBC,0xBB,0xBC,0xAC,0xCB,0xBA,0xBB,0xCB,0xBB,0xBB,0xBB,0xCB,0xBA,0x9A,0x8A,
+    0x00,0x32,0x54,0x54,0x53,0x34,0x44,0x53,0x53,0x43,0x43,0x32,0x22,0x22,0x21,0x22,
+    0x12,0x11,0x01,0x00,0x88,0xB9,0xCA,0xBC,0xBC,0xCC,0xCB,0xCB,0xCB,0xBB,0xBC,0xBC,
+    0xCB,0xCB,0xBB,0xCB,0xCB,0xCA,0xBA,0xBB,0xCB,0xBB,0xCB,0xBB,0xBB,0xBB,0xAC,0xBA,
+    0xAA,0x89,0x18,0x31,0x45,0x54,0x53,0x34,0x44,0x53,0x53,0x43,0x43,0x32,0x22,0x22,
+    0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,0xBB,0xCD,0xCB,0xCB,0xBC,0xDB,0xCA,0xBA,
+    0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xBC,0xBC,0xCA,0xAB,0xAC,0xAB,0xBB,0xBC,0xBA,0xBB,
+    0xBB,0xBB,0xAB,0x99,0x00,0x42,0x44,0x45,0x44,0x34,0x44,0x43,0x35,0x44,0x33,0x23,
+    0x33,0x32,0x32,0x22,0x13,0x12,0x01,0x00,0x90,0xAA,0xCC,0xCB,0xCB,0xBC,0xAD,0xAC,
+    0xCB,0xBB,0xCC,0xBA,0xAC,0xCB,0xBB,0xAC,0xAC,0xBB,0xCB,0xBB,0xAC,0xBB,0xAC,0xBB,
+    0xCB,0xAA,0xAB,0xBA,0x9A,0x8A,0x00,0x32,0x54,0x54,0x53,0x34,0x44,0x53,0x53,0x43,
+    0x43,0x32,0x22,0x22,0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,0xCB,0xCB,0xCC,0xBB,
+    0xBD,0xBC,0xCB,0xCB,0xCB,0xBB,0xBC,0xCB,0xCB,0xBB,0xCB,0xCB,0xBA,0xAC,0xBB,0xCB,
+    0xAB,0xAC,0xAB,0xAB,0xAB,0xBB,0xAA,0x99,0x00,0x32,0x45,0x45,0x44,0x34,0x44,0x43,
+    0x35,0x44,0x33,0x23,0x33,0x32,0x32,0x22,0x13,0x12,0x01,0x00,0x88,0xAA,0xCC,0xCB,
+    0xCB,0xBC,0xAD,0xAC,0xCB,0xBB,0xCC,0xBA,0xAC,0xCB,0xBB,0xAC,0xAC,0xBB,0xCB,0xBB,
+    0xAC,0xBB,0xAC,0xBB,0xCB,0xAA,0xBA,0xBA,0x9A,0x8A,0x00,0x32,0x54,0x54,0x53,0x34,
+    0x44,0x53,0x53,0x43,0x43,0x32,0x22,0x22,0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,
+    0xCB,0xDB,0xCB,0xCB,0xBC,0xDB,0xCA,0xBA,0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xBC,0xAC,
+    0xCB,0xAB,0xAC,0xAB,0xBB,0xBC,0xBA,0xBB,0xBB,0xBB,0xAB,0x99,0x10,0x41,0x44,0x45,
+    0x44,0x34,0x44,0x43,0x35,0x44,0x42,0x22,0x22,0x21,0x22,0x21,0x11,0x11,0x01,0x00,
+    0x88,0x9A,0xCB,0xCB,0xCB,0xBC,0xAD,0xAC,0xCB,0xBB,0xBC,0xBC,0xAC,0xCB,0xBB,0xCB,
+    0xCB,0xBB,0xCB,0xBB,0xCB,0xBB,0xCB,0xBB,0xBB,0xBB,0xAC,0xBA,0xAA,0x89,0x18,0x31,
+    0x45,0x54,0x53,0x34,0x44,0x53,0x53,0x43,0x43,0x22,0x23,0x22,0x21,0x22,0x12,0x11,
+    0x01,0x00,0x88,0xB9,0xBB,0xCD,0xCB,0xCB,0xBC,0xDB,0xCA,0xBA,0xBC,0xCB,0xBB,0xBC,
+    0xBC,0xBB,0xBC,0xAC,0xCB,0xBA,0xAC,0xAB,0xCB,0xBA,0xAB,0xBB,0xBB,0xBB,0xAB,0x99,
+    0x00,0x42,0x44,0x45,0x44,0x34,0x44,0x43,0x35,0x44,0x42,0x22,0x22,0x21,0x22,0x21,
+    0x11,0x11,0x01,0x00,0x98,0x99,0xCB,0xCB,0xCB,0xBC,0xAD,0xAC,0xCB,0xBB,0xBC,0xBC,
+    0xAC,0xCB,0xBB,0xCB,0xCB,0xBB,0xCB,0xBB,0xCB,0xBB,0xCB,0xBB,0xBB,0xBB,0xAC,0xBA,
+    0xAA,0x89,0x00,0x22,0x45,0x54,0x53,0x34,0x44,0x53,0x53,0x43,0x43,0x22,0x23,0x22,
+    0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,0xBB,0xCD,0xCB,0xCB,0xBC,0xDB,0xCA,0xBA,
+    0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xBC,0xAC,0xCB,0xBA,0xAC,0xAB,0xBB,0xBC,0xAB,0xBB,
+    0xBB,0xBB,0xBA,0x99,0x10,0x41,0x44,0x45,0x44,0x34,0x44,0x43,0x35,0x44,0x42,0x22,
+    0x22,0x21,0x12,0x22,0x21,0x10,0x01,0x00,0x98,0x99,0xCB,0xCB,0xCB,0xBC,0xAD,0xAC,
+    0xCB,0xBB,0xBC,0xBC,0xAC,0xCB,0xBB,0xCB,0xCB,0xBB,0xCB,0xBB,0xCB,0xBB,0xCB,0xBB,
+    0xBB,0xBB,0xAC,0xBA,0x9A,0x8A,0x00,0x22,0x45,0x54,0x53,0x34,0x44,0x53,0x53,0x43,
+    0x43,0x22,0x23,0x22,0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,0xCB,0xCB,0xBC,0xBD,
+    0xDB,0xBB,0xBC,0xBC,0xCB,0xAC,0xCB,0xCA,0xBA,0xCB,0xBB,0xCB,0xBB,0xBC,0xBB,0xAC,
+    0xCB,0xBA,0xBB,0xBA,0xBB,0xBB,0xAB,0x8A,0x18,0x42,0x44,0x45,0x44,0x34,0x34,0x45,
+    0x53,0x43,0x43,0x32,0x22,0x12,0x22,0x22,0x12,0x11,0x01,0x00,0x88,0xB9,0xCB,0xCB,
+    0xBC,0xBD,0xDB,0xBB,0xBC,0xDB,0xBB,0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xBC,0xCB,0xBB,
+    0xBC,0xBA,0xAC,0xBB,0xAC,0xAA,0xAB,0xBA,0xAA,0x89,0x00,0x22,0x54,0x54,0x34,0x35,
+    0x44,0x53,0x53,0x43,0x43,0x22,0x23,0x22,0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,
+    0xCB,0xDB,0xBB,0xCD,0xBB,0xBC,0xBC,0xBC,0xCB,0xAC,0xCB,0xBB,0xCB,0xCB,0xBB,0xCB,
+    0xBB,0xBC,0xBB,0xBC,0xCA,0xBA,0xBB,0xBA,0xBB,0xBB,0xAB,0x99,0x00,0x42,0x44,0x45,
+    0x44,0x34,0x34,0x45,0x53,0x43,0x43,0x32,0x22,0x12,0x22,0x22,0x12,0x11,0x01,0x00,
+    0x88,0xAA,0xBB,0xCD,0xCB,0xCB,0xBC,0xDB,0xCA,0xBA,0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,
+    0xBC,0xAC,0xCB,0xBA,0xCB,0xBA,0xBB,0xBC,0xBA,0xBB,0xBB,0xBB,0xBA,0x99,0x10,0x41,
+    0x44,0x45,0x44,0x34,0x34,0x45,0x53,0x43,0x43,0x32,0x22,0x22,0x21,0x22,0x12,0x11,
+    0x01,0x00,0x98,0xA9,0xCB,0xDB,0xCB,0xCB,0xBC,0xDB,0xCA,0xBA,0xBC,0xCB,0xBB,0xBC,
+    0xBC,0xBB,0xBC,0xAC,0xCB,0xBA,0xCB,0xBA,0xBB,0xBC,0xBA,0xBB,0xBB,0xBB,0xBA,0x99,
+    0x10,0x32,0x55,0x54,0x34,0x35,0x44,0x43,0x35,0x44,0x42,0x22,0x22,0x21,0x12,0x22,
+    0x21,0x10,0x01,0x00,0x98,0x99,0xCB,0xCB,0xCB,0xBC,0xAD,0xAC,0xCB,0xBB,0xBC,0xBC,
+    0xCB,0xCB,0xBB,0xCB,0xCB,0xAB,0xBC,0xCA,0xBA,0xBB,0xCB,0xBB,0xBB,0xBB,0xCB,0xAA,
+    0x9B,0x99,0x00,0x22,0x45,0x54,0x53,0x34,0x44,0x53,0x53,0x43,0x43,0x22,0x23,0x22,
+    0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,0xCB,0xDB,0xCB,0xCB,0xBC,0xDB,0xCA,0xBA,
+    0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xBC,0xAC,0xCB,0xBA,0xCB,0xBA,0xBB,0xBC,0xBA,0xBB,
+    0xBB,0xBB,0xBA,0x99,0x10,0x32,0x55,0x54,0x34,0x35,0x44,0x43,0x35,0x44,0x42,0x22,
+    0x22,0x21,0x12,0x22,0x21,0x10,0x01,0x00,0x98,0x99,0xCB,0xCB,0xCB,0xBC,0xAD,0xAC,
+    0xCB,0xBB,0xBC,0xBC,0xCB,0xCB,0xBB,0xCB,0xCB,0xCA,0xBA,0xBB,0xCB,0xBB,0xCB,0xBB,
+    0xBB,0xBB,0xCB,0xBA,0x9A,0x99,0x00,0x22,0x45,0x54,0x53,0x34,0x44,0x53,0x53,0x43,
+    0x43,0x22,0x23,0x22,0x21,0x22,0x12,0x11,0x01,0x00,0x98,0xA9,0xCB,0xDB,0xBB,0xCD,
+    0xBB,0xBC,0xBC,0xBC,0xCB,0xAC,0xCB,0xBB,0xCB,0xCB,0xBB,0xCB,0xBB,0xBC,0xBB,0xAC,
+    0xCB,0xBA,0xBB,0xBA,0xBB,0xBB,0xAB,0x8A,0x00,0x42,0x44,0x45,0x44,0x34,0x34,0x45,
+    0x53,0x43,0x43,0x32,0x22,0x12,0x22,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,0xCB,0xCB,
+    0xCC,0xBB,0xBD,0xBC,0xCB,0xCB,0xCB,0xBB,0xBC,0xCB,0xCB,0xBB,0xCB,0xBB,0xBC,0xAC,
+    0xBB,0xCB,0xBA,0xCB,0xBA,0xBA,0xAB,0xAB,0xAB,0x99,0x10,0x31,0x55,0x44,0x44,0x53,
+    0x43,0x34,0x45,0x43,0x43,0x32,0x22,0x22,0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,
+    0xCB,0xCB,0xCC,0xBB,0xBD,0xBC,0xCB,0xCB,0xCB,0xBB,0xBC,0xCB,0xCB,0xBB,0xCB,0xBB,
+    0xBC,0xAC,0xBB,0xCB,0xBA,0xCB,0xBA,0xBA,0xAB,0xAB,0xAB,0x99,0x10,0x31,0x55,0x44,
+    0x44,0x53,0x43,0x34,0x45,0x43,0x43,0x32,0x22,0x22,0x21,0x22,0x12,0x11,0x01,0x00,
+    0x88,0xAA,0xCB,0xCB,0xCC,0xBB,0xBD,0xBC,0xCB,0xCB,0xCB,0xBB,0xBC,0xCB,0xCB,0xBB,
+    0xCB,0xBB,0xBC,0xAC,0xBB,0xCB,0xBA,0xCB,0xBA,0xBA,0xAB,0xAB,0xAB,0x99,0x10,0x31,
+    0x55,0x44,0x44,0x53,0x43,0x34,0x45,0x43,0x43,0x32,0x22,0x22,0x21,0x22,0x12,0x11,
+    0x01,0x00,0x88,0xAA,0xCB,0xCB,0xCC,0xBB,0xBD,0xBC,0xCB,0xCB,0xCB,0xBB,0xBC,0xCB,
+    0xCB,0xBB,0xCB,0xBB,0xBC,0xAC,0xBB,0xCB,0xBA,0xCB,0xBA,0xBA,0xAB,0xAB,0xAB,0x99,
+    0x10,0x31,0x55,0x44,0x44,0x53,0x43,0x34,0x45,0x43,0x43,0x32,0x22,0x22,0x21,0x22,
+    0x12,0x11,0x01,0x00,0x88,0xAA,0xCB,0xDB,0xBB,0xCD,0xBB,0xBC,0xBC,0xBC,0xCB,0xAC,
+    0xCB,0xBB,0xCB,0xCB,0xBB,0xCB,0xBB,0xBC,0xBB,0xAC,0xCB,0xBA,0xBB,0xBA,0xBB,0xBB,
+    0xAB,0x99,0x00,0x42,0x44,0x45,0x44,0x34,0x34,0x45,0x53,0x43,0x43,0x22,0x23,0x22,
+    0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,0xBB,0xCD,0xCB,0xCB,0xBC,0xDB,0xCA,0xBA,
+    0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xBC,0xAC,0xCB,0xBA,0xCB,0xBA,0xBB,0xBC,0xBA,0xBB,
+    0xBB,0xBB,0xBA,0x89,0x18,0x32,0x55,0x54,0x34,0x35,0x44,0x43,0x35,0x44,0x42,0x22,
+    0x22,0x21,0x12,0x22,0x21,0x10,0x01,0x00,0x98,0xA9,0xCA,0xCB,0xCB,0xBC,0xCC,0xBB,
+    0xBC,0xBC,0xCB,0xAC,0xCB,0xCA,0xBA,0xCB,0xBB,0xCB,0xBB,0xBC,0xBB,0xAC,0xCB,0xBA,
+    0xAB,0xBB,0xBB,0xBB,0xAB,0x99,0x00,0x42,0x44,0x45,0x44,0x34,0x34,0x45,0x53,0x43,
+    0x43,0x22,0x23,0x22,0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,0xCB,0xCB,0xBC,0xBD,
+    0xDB,0xBB,0xBC,0xDB,0xBB,0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xBC,0xCB,0xBB,0xBC,0xBA,
+    0xAC,0xBB,0xCB,0xAA,0xAB,0xAA,0x9B,0x8A,0x00,0x22,0x45,0x54,0x53,0x34,0x44,0x43,
+    0x35,0x44,0x42,0x22,0x22,0x21,0x22,0x21,0x11,0x11,0x01,0x00,0x98,0xA9,0xCA,0xCB,
+    0xCB,0xBC,0xCC,0xBB,0xBC,0xBC,0xCB,0xAC,0xCB,0xCA,0xBA,0xCB,0xBB,0xCB,0xBB,0xBC,
+    0xBB,0xAC,0xCB,0xBA,0xAB,0xBB,0xBB,0xBB,0xAB,0x99,0x00,0x42,0x44,0x45,0x44,0x34,
+    0x34,0x45,0x53,0x43,0x43,0x22,0x23,0x22,0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,
+    0xCB,0xCB,0xBC,0xBD,0xDB,0xBB,0xBC,0xDB,0xBB,0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xBC,
+    0xCB,0xBB,0xBC,0xBA,0xAC,0xBB,0xCB,0xAA,0xAB,0xAA,0x9B,0x8A,0x00,0x22,0x45,0x54,
+    0x53,0x34,0x44,0x43,0x35,0x44,0x42,0x22,0x22,0x21,0x22,0x21,0x11,0x11,0x01,0x00,
+    0x98,0xA9,0xCA,0xCB,0xCB,0xBC,0xCC,0xBB,0xBC,0xBC,0xCB,0xAC,0xCB,0xCA,0xBA,0xCB,
+    0xBB,0xCB,0xBB,0xBC,0xBB,0xAC,0xCB,0xBA,0xAB,0xBB,0xBB,0xBB,0xAB,0x99,0x00,0x42,
+    0x44,0x45,0x44,0x34,0x34,0x45,0x53,0x43,0x43,0x22,0x23,0x22,0x21,0x22,0x12,0x11,
+    0x01,0x00,0x88,0xAA,0xCB,0xCB,0xBC,0xBD,0xDB,0xBB,0xBC,0xDB,0xBB,0xBC,0xCB,0xBB,
+    0xBC,0xBC,0xBB,0xBC,0xCB,0xBB,0xBC,0xBA,0xAC,0xBB,0xCB,0xAA,0xAB,0xAA,0x9B,0x8A,
+    0x00,0x22,0x45,0x54,0x53,0x34,0x44,0x43,0x35,0x44,0x42,0x22,0x22,0x21,0x22,0x21,
+    0x11,0x11,0x01,0x00,0x98,0xA9,0xCA,0xCB,0xCB,0xBC,0xCC,0xBB,0xBC,0xBC,0xCB,0xAC,
+    0xCB,0xCA,0xBA,0xCB,0xBB,0xCB,0xBB,0xBC,0xBB,0xAC,0xCB,0xBA,0xAB,0xBB,0xBB,0xBB,
+    0xAB,0x99,0x00,0x42,0x44,0x45,0x44,0x34,0x34,0x45,0x53,0x43,0x43,0x22,0x23,0x22,
+    0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,0xCB,0xCB,0xBC,0xBD,0xDB,0xBB,0xBC,0xDB,
+    0xBB,0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xBC,0xCB,0xBB,0xBC,0xBA,0xAC,0xBB,0xCB,0xAA,
+    0xAB,0xAA,0x9B,0x8A,0x00,0x22,0x45,0x54,0x53,0x34,0x44,0x43,0x35,0x44,0x42,0x22,
+    0x22,0x21,0x22,0x21,0x11,0x11,0x01,0x00,0x98,0xA9,0xCA,0xCB,0xCB,0xBC,0xCC,0xBB,
+    0xBC,0xBC,0xCB,0xAC,0xCB,0xCA,0xBA,0xCB,0xBB,0xCB,0xBB,0xBC,0xBB,0xAC,0xCB,0xBA,
+    0xAB,0xBB,0xBB,0xBB,0xAB,0x99,0x00,0x42,0x44,0x45,0x44,0x34,0x34,0x45,0x53,0x43,
+    0x43,0x22,0x23,0x22,0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,0xCB,0xCB,0xBC,0xBD,
+    0xDB,0xBB,0xBC,0xDB,0xBB,0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xBC,0xCB,0xBB,0xBC,0xBA,
+    0xAC,0xBB,0xCB,0xAA,0xAB,0xAA,0x9B,0x8A,0x00,0x22,0x45,0x54,0x53,0x34,0x44,0x43,
+    0x35,0x44,0x42,0x22,0x22,0x21,0x22,0x21,0x11,0x11,0x01,0x00,0x98,0xA9,0xCA,0xCB,
+    0xCB,0xBC,0xCC,0xBB,0xBC,0xBC,0xCB,0xAC,0xCB,0xCA,0xBA,0xCB,0xBB,0xCB,0xBB,0xBC,
+    0xBB,0xAC,0xCB,0xBA,0xAB,0xBB,0xBB,0xBB,0xAB,0x99,0x00,0x42,0x44,0x45,0x44,0x34,
+    0x34,0x45,0x53,0x43,0x43,0x22,0x23,0x22,0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,
+    0xCB,0xCB,0xBC,0xBD,0xDB,0xBB,0xBC,0xDB,0xBB,0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xBC,
+    0xCB,0xBB,0xBC,0xBA,0xAC,0xBB,0xCB,0xAA,0xAB,0xAA,0x9B,0x8A,0x00,0x22,0x45,0x54,
+    0x53,0x34,0x44,0x43,0x35,0x44,0x42,0x22,0x22,0x21,0x22,0x21,0x11,0x11,0x01,0x00,
+    0x98,0xA9,0xCA,0xCB,0xCB,0xBC,0xCC,0xBB,0xBC,0xBC,0xCB,0xAC,0xCB,0xCA,0xBA,0xCB,
+    0xBB,0xCB,0xBB,0xBC,0xBB,0xAC,0xCB,0xBA,0xAB,0xBB,0xBB,0xBB,0xAB,0x99,0x00,0x42,
+    0x44,0x45,0x44,0x34,0x34,0x45,0x53,0x43,0x43,0x22,0x23,0x22,0x21,0x22,0x12,0x11,
+    0x01,0x00,0x88,0xAA,0xCB,0xCB,0xBC,0xBD,0xDB,0xBB,0xBC,0xDB,0xBB,0xBC,0xCB,0xBB,
+    0xBC,0xBC,0xBB,0xBC,0xCB,0xBB,0xBC,0xBA,0xAC,0xBB,0xCB,0xAA,0xAB,0xAA,0x9B,0x8A,
+    0x00,0x22,0x45,0x54,0x53,0x34,0x44,0x43,0x35,0x44,0x42,0x22,0x22,0x21,0x22,0x21,
+    0x11,0x11,0x01,0x00,0x98,0xA9,0xCA,0xCB,0xCB,0xBC,0xCC,0xBB,0xBC,0xBC,0xCB,0xAC,
+    0xCB,0xCA,0xBA,0xCB,0xBB,0xCB,0xBB,0xBC,0xBB,0xAC,0xCB,0xBA,0xAB,0xBB,0xBB,0xBB,
+    0xAB,0x99,0x00,0x42,0x44,0x45,0x44,0x34,0x34,0x45,0x53,0x43,0x43,0x22,0x23,0x22,
+    0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,0xCB,0xCB,0xBC,0xBD,0xDB,0xBB,0xBC,0xDB,
+    0xBB,0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xBC,0xCB,0xBB,0xBC,0xBA,0xAC,0xBB,0xCB,0xAA,
+    0xAB,0xAA,0x9B,0x8A,0x00,0x22,0x45,0x54,0x53,0x34,0x44,0x43,0x35,0x44,0x42,0x22,
+    0x22,0x21,0x22,0x21,0x11,0x11,0x01,0x00,0x98,0xA9,0xCA,0xCB,0xCB,0xBC,0xCC,0xBB,
+    0xBC,0xBC,0xCB,0xAC,0xCB,0xCA,0xBA,0xCB,0xBB,0xCB,0xBB,0xBC,0xBB,0xAC,0xCB,0xBA,
+    0xAB,0xBB,0xBB,0xBB,0xAB,0x99,0x00,0x42,0x44,0x45,0x44,0x34,0x34,0x45,0x53,0x43,
+    0x43,0x22,0x23,0x22,0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,0xCB,0xCB,0xBC,0xBD,
+    0xDB,0xBB,0xBC,0xDB,0xBB,0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xBC,0xCB,0xBB,0xBC,0xBA,
+    0xAC,0xBB,0xCB,0xAA,0xAB,0xAA,0x9B,0x8A,0x00,0x22,0x45,0x54,0x53,0x34,0x44,0x43,
+    0x35,0x44,0x42,0x22,0x22,0x21,0x22,0x21,0x11,0x11,0x01,0x00,0x98,0xA9,0xCA,0xCB,
+    0xCB,0xBC,0xCC,0xBB,0xBC,0xBC,0xCB,0xAC,0xCB,0xCA,0xBA,0xCB,0xBB,0xCB,0xBB,0xBC,
+    0xBB,0xAC,0xCB,0xBA,0xAB,0xBB,0xBB,0xBB,0xAB,0x99,0x00,0x42,0x44,0x45,0x44,0x34,
+    0x34,0x45,0x53,0x43,0x43,0x22,0x23,0x22,0x21,0x22,0x12,0x11,0x01,0x00,0x88,0xAA,
+    0xCB,0xCB,0xBC,0xBD,0xDB,0xBB,0xBC,0xDB,0xBB,0xBC,0xCB,0xBB,0xBC,0xBC,0xBB,0xBC,
+    0xCB,0xBB,0xBC,0xBA,0xAC,0xBB,0xCB,0xAA,0xAB,0xAA,0x9B,0x8A,0x00,0x22,0x45,0x54,
+    0x53,0x34,0x44,0x43,0x35,0x44,0x42,0x22,0x22,0x21,0x22,0x21,0x11,0x11,0x01,0x00,
+    0x98,0xA9,0xCA,0xCB,0xCB,0xBC,0xCC,0xBB,0xBC,0xBC,0xCB,0xAC,0xCB,0xCA,0xBA,0xCB,
+    0xBB,0xCB,0xBB,0xBC,0xBB,0xAC,0xCB,0xBA,0xAB,0xBB,0xBB,0xBB,0xAB,0x99,0x00,0x42,
+    0x44,0x45,0x44,0x34,0x34,0x45,0x53,0x43,0x43,0x22,0x23,0x22,0x21,0x22,0x12,0x11,
+    0x01,0x00,0x88,0xAA,0xCB,0xCB,0xBC,0xBD,0xDB,0xBB,0xBC,0xDB,0xBB,0xBC,0xCB,0xBB,
+    0xBC,0xBC,0xBB,0xBC,0xCB,0xBB,0xBC,0xBA,0xAC,0xBB,0xCB,0xAA,0xAB,0xAA,0x9B,0x8A,
+    0x00,0x22,0x45,0x54,0x53,0x34,0x44,0x43,0x35,0x44,0x42,0x22
+};
+
+const AdpcmSample samplePianoA3 = {samplePianoA3Data, 11000, 22000, 220.00f, 8800, 10800, 3032, 51};
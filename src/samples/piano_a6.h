@@ -0,0 +1,214 @@
+// Synthesised placeholder, not a recording: generated by tools/pianogen.cpp
+//   ./pianogen PianoA6 1760 0.3 5000 6500
+// 6600 samples at 22000 Hz, root 1760.00 Hz, loop 5000..6500, 3300 bytes
+const uint8_t samplePianoA6Data[3300] = {
+    0x70,0x77,0x07,0xFF,0xBE,0xB9,0x77,0x83,0x99,0xAA,0xBB,0xAB,0x77,0x84,0x98,0x99,
+    0x9B,0x8B,0x79,0x17,0x98,0x98,0xA9,0x99,0x49,0x27,0x88,0x99,0xA9,0x99,0x98,0x77,
+    0x88,0x88,0x89,0x89,0x89,0x72,0x81,0x88,0x99,0x99,0x0A,0x78,0x84,0x90,0x99,0x99,
+    0x99,0x38,0x37,0x90,0xA9,0xA9,0xB9,0x90,0x77,0x80,0x98,0x98,0x99,0x98,0x73,0x82,
+    0x98,0x99,0x9A,0x0A,0x78,0x86,0x88,0x98,0x99,0x89,0x28,0x27,0x88,0x99,0xA9,0x99,
+    0x88,0x67,0x88,0x88,0x99,0x89,0x89,0x73,0x01,0x89,0x99,0x9A,0x8A,0x70,0x85,0x90,
+    0x98,0xA9,0x89,0x38,0x37,0x98,0x99,0xA9,0xAA,0x08,0x77,0x08,0x89,0x89,0x99,0x09,
+    0x72,0x01,0x89,0x99,0x9A,0x89,0x78,0x85,0x90,0x98,0xA9,0x98,0x38,0x37,0x98,0x99,
+    0xA9,0x9A,0x88,0x77,0x08,0x89,0x89,0x99,0x09,0x72,0x01,0x89,0x99,0x9A,0x89,0x70,
+    0x04,0x98,0x99,0x99,0x8A,0x38,0x47,0x88,0x99,0xA9,0xA9,0x08,0x57,0x80,0x89,0x99,
+    0x9A,0x88,0x73,0x83,0x98,0xAA,0x9A,0x8A,0x70,0x07,0x98,0x98,0x99,0x98,0x20,0x27,
+    0x88,0x99,0x9A,0xA9,0x08,0x57,0x80,0x89,0xA9,0x99,0x88,0x73,0x83,0x89,0x9A,0x9B,
+    0x8A,0x70,0x87,0x90,0x98,0x98,0x99,0x20,0x27,0x98,0x98,0xA9,0xA9,0x18,0x57,0x88,
+    0x98,0x99,0x99,0x88,0x73,0x83,0x89,0xAA,0x9A,0x8A,0x71,0x06,0x98,0x98,0xA9,0x89,
+    0x48,0x17,0x88,0x99,0x99,0x99,0x08,0x47,0x08,0x99,0x99,0xA9,0x88,0x74,0x01,0x89,
+    0x9A,0x99,0x8A,0x71,0x04,0x98,0x99,0xA9,0x99,0x40,0x17,0x80,0x99,0xAA,0x99,0x08,
+    0x57,0x80,0x89,0xA9,0x99,0x09,0x73,0x83,0x98,0xAA,0x9A,0x8A,0x70,0x07,0x98,0x98,
+    0x99,0x89,0x30,0x17,0x90,0xA8,0xA9,0x99,0x08,0x57,0x80,0x89,0x9A,0x99,0x09,0x74,
+    0x81,0x98,0x99,0xA9,0x89,0x71,0x04,0x98,0x99,0xA9,0x99,0x40,0x17,0x90,0xA8,0x99,
+    0x9A,0x18,0x47,0x80,0x98,0x9A,0xAA,0x88,0x75,0x81,0x98,0x99,0x99,0x0A,0x70,0x84,
+    0x90,0x99,0xA9,0x89,0x48,0x17,0x90,0x98,0x9A,0x9A,0x18,0x47,0x80,0x89,0x9A,0x9A,
+    0x09,0x74,0x82,0x98,0x9A,0x9A,0x0A,0x70,0x05,0x88,0xA9,0x99,0x99,0x40,0x17,0x88,
+    0x99,0xA9,0x99,0x18,0x47,0x80,0x99,0x99,0x9A,0x09,0x74,0x01,0x98,0xA9,0x9A,0x0A,
+    0x71,0x04,0x88,0xA9,0x9A,0x9A,0x50,0x17,0x88,0xA8,0x99,0x9A,0x18,0x47,0x80,0x89,
+    0x9A,0x9A,0x09,0x74,0x01,0x98,0xA9,0x9A,0x89,0x71,0x04,0x88,0xA9,0x9A,0x9A,0x50,
+    0x17,0x88,0xA8,0x99,0x9A,0x28,0x37,0x80,0xA8,0xAA,0xAA,0x09,0x76,0x81,0x98,0x99,
+    0xA9,0x09,0x71,0x03,0x98,0xA9,0xAA,0x9A,0x60,0x17,0x88,0x99,0x99,0x9A,0x10,0x37,
+    0x80,0x99,0xAA,0xAA,0x09,0x76,0x81,0x98,0x99,0xA9,0x09,0x71,0x03,0x98,0xA9,0xAA,
+    0x9A,0x51,0x27,0x88,0xA9,0xA9,0x9A,0x28,0x57,0x80,0x99,0x99,0x9A,0x88,0x65,0x81,
+    0x98,0x99,0x9A,0x0A,0x71,0x04,0x98,0x99,0x9A,0x8A,0x40,0x17,0x80,0x99,0xAA,0x9A,
+    0x10,0x47,0x00,0x99,0xAA,0x9A,0x09,0x75,0x01,0x89,0x9A,0x9A,0x89,0x71,0x04,0x98,
+    0xA8,0x9A,0x8A,0x50,0x16,0x90,0x99,0x9A,0x9A,0x28,0x47,0x80,0x98,0xAA,0x9A,0x09,
+    0x75,0x81,0x88,0x9A,0x9A,0x89,0x72,0x03,0x90,0xAA,0xBA,0x99,0x60,0x17,0x88,0x99,
+    0xA9,0x99,0x28,0x37,0x00,0xA9,0xAA,0xAA,0x09,0x76,0x81,0x98,0x99,0x9A,0x89,0x72,
+    0x03,0x90,0xAA,0xAA,0x9A,0x60,0x17,0x88,0x99,0xA9,0x99,0x28,0x37,0x00,0xA9,0xAA,
+    0xAA,0x09,0x76,0x81,0x98,0x99,0x9A,0x89,0x72,0x03,0x88,0xAA,0xAA,0x9A,0x60,0x17,
+    0x88,0x99,0xA9,0x99,0x10,0x37,0x80,0xA8,0xAA,0xAA,0x09,0x76,0x81,0x98,0x99,0x9A,
+    0x09,0x71,0x03,0x88,0xAA,0xAA,0x9A,0x70,0x15,0x90,0x99,0xAA,0xA9,0x20,0x47,0x00,
+    0x99,0xAA,0xAA,0x19,0x75,0x01,0x89,0x9A,0x9A,0x0A,0x71,0x04,0x88,0xA9,0xAA,0x89,
+    0x50,0x16,0x90,0x99,0xAA,0x99,0x28,0x47,0x00,0x99,0xAA,0xAA,0x08,0x75,0x81,0x88,
+    0x9A,0x9A,0x89,0x72,0x13,0x98,0xAA,0xAB,0x9A,0x61,0x17,0x88,0xA8,0xA9,0x99,0x28,
+    0x37,0x00,0xA9,0xAA,0xAB,0x19,0x76,0x81,0x88,0x9A,0x9A,0x89,0x72,0x03,0x90,0xAA,
+    0xBA,0x9A,0x61,0x17,0x88,0xA8,0xA9,0x99,0x28,0x37,0x00,0xA9,0xAA,0xAB,0x19,0x57,
+    0x01,0x98,0xAA,0xAA,0x89,0x72,0x05,0x88,0xA9,0xA9,0x8A,0x50,0x16,0x90,0xA8,0x9A,
+    0x9A,0x28,0x47,0x80,0x98,0xAA,0xAA,0x08,0x56,0x01,0x98,0xAA,0xAA,0x89,0x72,0x05,
+    0x88,0xA9,0xA9,0x8A,0x50,0x16,0x90,0xA8,0x9A,0x9A,0x28,0x47,0x80,0x98,0xAA,0x9A,
+    0x09,0x56,0x01,0x89,0xAA,0xAA,0x89,0x73,0x04,0x90,0xA9,0xBA,0x99,0x51,0x17,0x80,
+    0xA9,0xA9,0x9A,0x10,0x47,0x80,0x98,0xAA,0x9A,0x19,0x65,0x01,0x98,0xAA,0xAA,0x09,
+    0x72,0x04,0x90,0xA9,0xBA,0x99,0x51,0x17,0x90,0xA8,0xA9,0x9A,0x20,0x37,0x81,0xA9,
+    0xBA,0xAA,0x19,0x76,0x01,0x89,0x9A,0xAA,0x09,0x72,0x13,0x98,0xAA,0xAB,0x9A,0x71,
+    0x15,0x80,0xA9,0xAA,0xAA,0x20,0x57,0x00,0x99,0xAA,0xA9,0x08,0x65,0x01,0x98,0xAA,
+    0x9A,0x0A,0x72,0x04,0x90,0xA9,0xAA,0x8A,0x50,0x17,0x90,0xA8,0xA9,0x9A,0x20,0x37,
+    0x81,0xA9,0xBA,0xAA,0x19,0x57,0x01,0x98,0xAA,0xAA,0x0A,0x72,0x05,0x90,0xA9,0x9A,
+    0x8A,0x50,0x16,0x80,0xA9,0xAA,0xA9,0x20,0x47,0x00,0x99,0xAA,0xAA,0x08,0x56,0x01,
+    0x98,0xAA,0xAA,0x0A,0x72,0x05,0x88,0xA9,0x9A,0x8A,0x50,0x16,0x80,0xA9,0xAA,0x99,
+    0x28,0x47,0x00,0x99,0xAA,0xAA,0x08,0x56,0x01,0x98,0xAA,0xAA,0x0A,0x72,0x05,0x88,
+    0xA9,0x9A,0x8A,0x50,0x16,0x80,0xA9,0xAA,0x99,0x28,0x47,0x00,0x99,0xAA,0xAA,0x08,
+    0x56,0x01,0x98,0xAA,0xAA,0x0A,0x72,0x05,0x88,0xA9,0x9A,0x8A,0x41,0x17,0x80,0xA9,
+    0xA9,0x9A,0x28,0x47,0x00,0x99,0xAA,0xAA,0x08,0x56,0x01,0x98,0xAA,0xAA,0x0A,0x73,
+    0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0xA9,0xA9,0x9A,0x28,0x47,0x00,0x99,0xAA,
+    0xAA,0x18,0x65,0x01,0x98,0xAA,0xAA,0x89,0x73,0x14,0x98,0xA9,0xAB,0x99,0x51,0x17,
+    0x80,0xA9,0xA9,0x9A,0x38,0x37,0x81,0x99,0xBB,0xAB,0x08,0x67,0x01,0x89,0xAA,0xA9,
+    0x89,0x73,0x13,0x98,0xAA,0xBB,0x8A,0x71,0x15,0x80,0xA9,0xAA,0x9B,0x20,0x57,0x00,
+    0x99,0xAA,0x9A,0x08,0x65,0x01,0x98,0xAA,0xAA,0x09,0x72,0x14,0x98,0xA9,0xAA,0x9A,
+    0x61,0x15,0x80,0xA9,0xAA,0xAA,0x20,0x57,0x00,0x99,0xAA,0x9A,0x08,0x65,0x01,0x98,
+    0xAA,0x9A,0x0A,0x72,0x14,0x98,0xA9,0xBA,0x99,0x61,0x15,0x80,0xA9,0xAA,0xAA,0x20,
+    0x57,0x00,0x99,0xAA,0x9A,0x08,0x65,0x01,0x98,0xAA,0x9A,0x0A,0x72,0x14,0x98,0xA9,
+    0xBA,0x99,0x61,0x15,0x80,0xA9,0xAA,0xAA,0x20,0x57,0x00,0x99,0xAA,0xA9,0x08,0x65,
+    0x01,0x98,0xAA,0xAA,0x09,0x72,0x14,0x98,0xA9,0xBA,0x99,0x61,0x15,0x80,0xA9,0xAA,
+    0xAA,0x30,0x57,0x80,0x98,0xAA,0x9A,0x19,0x65,0x01,0x98,0xAA,0xAA,0x09,0x72,0x04,
+    0x90,0xA9,0xBA,0x99,0x61,0x15,0x80,0xA9,0xBA,0xA9,0x20,0x57,0x00,0x99,0xAA,0x9A,
+    0x08,0x65,0x01,0x98,0xAA,0xAA,0x09,0x72,0x04,0x90,0xA9,0xAA,0x8A,0x60,0x15,0x80,
+    0xA9,0xAA,0xAA,0x30,0x47,0x81,0x99,0xBA,0xAA,0x18,0x56,0x02,0x99,0xAA,0xAB,0x0A,
+    0x73,0x15,0x98,0xA9,0xAA,0x8A,0x51,0x16,0x80,0xA9,0xAA,0x9A,0x38,0x57,0x80,0x98,
+    0xAA,0x9A,0x08,0x65,0x01,0x98,0xAA,0xAA,0x09,0x72,0x04,0x90,0xA9,0xAA,0x8A,0x60,
+    0x15,0x80,0xA9,0xAA,0xAA,0x20,0x57,0x00,0x99,0xAA,0x9A,0x08,0x65,0x01,0x98,0xAA,
+    0x9A,0x0A,0x72,0x04,0x90,0xA9,0xAA,0x8A,0x60,0x15,0x80,0xA9,0xAA,0xAA,0x30,0x47,
+    0x81,0x99,0xBA,0xAA,0x18,0x75,0x01,0x98,0x9A,0x9B,0x89,0x73,0x13,0x90,0xBA,0xBB,
+    0x9A,0x71,0x16,0x80,0xA9,0xAA,0xA9,0x20,0x47,0x00,0x99,0xAA,0xAA,0x08,0x56,0x01,
+    0x98,0xAA,0xAA,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0xA9,0xB9,0x99,
+    0x38,0x37,0x01,0x9A,0xBB,0xAB,0x19,0x67,0x01,0x98,0xAA,0x9A,0x89,0x72,0x04,0x90,
+    0xA9,0xAA,0x8A,0x60,0x15,0x80,0xA9,0xAA,0xAA,0x30,0x47,0x81,0x99,0xBA,0xAA,0x18,
+    0x75,0x01,0x98,0x9A,0x9B,0x89,0x73,0x13,0xA0,0xB9,0xBB,0x9A,0x71,0x16,0x80,0xA9,
+    0xAA,0x99,0x28,0x47,0x00,0x99,0xAA,0xAA,0x08,0x56,0x01,0x98,0xAA,0xAA,0x0A,0x73,
+    0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0xA9,0xA9,0x9A,0x38,0x37,0x81,0x99,0xBB,
+    0xAB,0x29,0x57,0x82,0x98,0xAA,0xAB,0x09,0x72,0x15,0x98,0xA9,0xAA,0x99,0x51,0x16,
+    0x80,0xA9,0xAA,0x9A,0x20,0x47,0x81,0x99,0xAA,0x9B,0x19,0x56,0x82,0x98,0xAA,0xAB,
+    0x09,0x72,0x15,0x98,0xA9,0xAA,0x99,0x51,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x81,
+    0x99,0xAA,0x9B,0x19,0x56,0x82,0x98,0xAA,0xAB,0x09,0x72,0x15,0x98,0xA9,0xAA,0x99,
+    0x51,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x81,0x99,0xAA,0x9B,0x19,0x56,0x82,0x98,
+    0xAA,0xAB,0x09,0x72,0x05,0x90,0xA9,0xAA,0x99,0x51,0x16,0x80,0xA9,0xAA,0x9A,0x20,
+    0x47,0x81,0x99,0xAA,0x9B,0x19,0x56,0x82,0x98,0xAA,0xAB,0x09,0x73,0x05,0x90,0xA9,
+    0xAA,0x8A,0x51,0x16,0x80,0xA9,0xAA,0x9A,0x38,0x47,0x81,0x99,0xBA,0x9A,0x19,0x56,
+    0x01,0x98,0xAA,0xAB,0x09,0x73,0x05,0x90,0xA9,0xAA,0x8A,0x51,0x16,0x80,0xA9,0xAA,
+    0x9A,0x38,0x47,0x81,0x99,0xBA,0xAA,0x18,0x56,0x01,0x98,0xAA,0xAB,0x09,0x73,0x05,
+    0x90,0xA9,0xAA,0x8A,0x51,0x16,0x80,0xA9,0xAA,0x9A,0x38,0x47,0x00,0x99,0xAA,0x9B,
+    0x19,0x56,0x01,0x98,0xAA,0xAB,0x09,0x73,0x05,0x90,0xA9,0xAA,0x8A,0x51,0x16,0x80,
+    0xA9,0xAA,0x9A,0x38,0x47,0x00,0x99,0xAA,0x9B,0x19,0x56,0x01,0x98,0xAA,0xAB,0x09,
+    0x73,0x05,0x90,0xA9,0xAA,0x8A,0x51,0x16,0x80,0xA9,0xAA,0x9A,0x38,0x47,0x00,0x99,
+    0xAA,0x9B,0x19,0x56,0x01,0x98,0xAA,0xAB,0x09,0x73,0x05,0x90,0xA9,0xAA,0x8A,0x51,
+    0x16,0x80,0xA9,0xAA,0x9A,0x38,0x47,0x00,0x99,0xAA,0x9B,0x19,0x56,0x01,0x98,0xAA,
+    0xAB,0x09,0x73,0x05,0x88,0xA9,0xAA,0x8A,0x51,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,
+    0x00,0x99,0xAA,0x9B,0x19,0x56,0x01,0x98,0xAA,0xAB,0x09,0x73,0x05,0x90,0xA9,0xAA,
+    0x8A,0x51,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xBA,0x9A,0x19,0x56,0x01,
+    0x98,0xAA,0xBA,0x09,0x73,0x05,0x88,0xA9,0xAA,0x8A,0x51,0x16,0x80,0xA9,0xAA,0x9A,
+    0x20,0x47,0x00,0x99,0xAA,0x9B,0x19,0x56,0x01,0x98,0xAA,0xAB,0x09,0x73,0x05,0x88,
+    0xA9,0xAA,0x99,0x51,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x19,
+    0x56,0x01,0x98,0xAA,0xAB,0x09,0x73,0x05,0x88,0xA9,0xAA,0x99,0x51,0x16,0x80,0xA9,
+    0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x19,0x56,0x01,0x98,0xAA,0xAB,0x09,0x73,
+    0x05,0x88,0xA9,0xAA,0x99,0x51,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,
+    0x9B,0x19,0x56,0x01,0x98,0xAA,0xAB,0x09,0x73,0x05,0x88,0xA9,0xAA,0x99,0x51,0x16,
+    0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x19,0x56,0x01,0x98,0xAA,0xAB,
+    0x09,0x73,0x14,0x88,0xAA,0xAB,0x9A,0x71,0x24,0x80,0xAA,0xBA,0xAA,0x30,0x57,0x81,
+    0x99,0xAA,0xAA,0x18,0x65,0x82,0x98,0xAA,0xAA,0x0A,0x73,0x05,0x88,0xA9,0xAA,0x99,
+    0x51,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x19,0x56,0x01,0x98,
+    0xAA,0xAA,0x0A,0x73,0x14,0x88,0xAA,0xAB,0x9A,0x71,0x24,0x90,0xA9,0xBA,0xAA,0x30,
+    0x67,0x80,0x98,0x9A,0x9A,0x08,0x55,0x01,0x98,0xAA,0xAB,0x09,0x72,0x05,0x90,0xA9,
+    0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0xAA,0x19,0x56,
+    0x01,0x98,0xAA,0xAA,0x0A,0x73,0x14,0x88,0xAA,0xAB,0x8A,0x70,0x24,0x90,0xA9,0xBA,
+    0xAA,0x30,0x67,0x80,0x98,0x9A,0x9A,0x19,0x55,0x01,0x98,0xAA,0xAB,0x09,0x73,0x14,
+    0x98,0xA9,0xAB,0x8A,0x70,0x24,0x90,0xA9,0xBA,0xAA,0x30,0x67,0x80,0x98,0x9A,0x9A,
+    0x08,0x55,0x01,0x98,0xAA,0xAB,0x09,0x72,0x05,0x90,0xA9,0xAA,0x89,0x50,0x16,0x80,
+    0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0xAA,0x08,0x56,0x01,0x98,0xAA,0xAA,0x0A,
+    0x73,0x14,0x98,0xA9,0xAB,0x8A,0x61,0x25,0x90,0xA9,0xBA,0xAA,0x30,0x57,0x81,0x99,
+    0xAA,0xAA,0x18,0x65,0x01,0x98,0xAA,0xAA,0x89,0x73,0x05,0x88,0xA9,0xAA,0x89,0x50,
+    0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x19,0x56,0x01,0x98,0xAA,
+    0xAA,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x61,0x25,0x90,0xA9,0xBA,0xAA,0x30,0x57,
+    0x81,0x99,0xAA,0xAA,0x18,0x65,0x01,0x98,0xB9,0xAA,0x89,0x73,0x05,0x88,0xA9,0xAA,
+    0x99,0x51,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x08,0x56,0x01,
+    0x98,0xAA,0xBA,0x09,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x61,0x25,0x90,0xA9,0xBA,0xAA,
+    0x30,0x57,0x81,0x99,0xAA,0xAA,0x18,0x65,0x01,0x98,0xB9,0xAA,0x89,0x73,0x05,0x88,
+    0xA9,0xAA,0x99,0x51,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x08,
+    0x56,0x01,0x98,0xAA,0xAA,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0x99,
+    0xBA,0xA9,0x30,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,0xB9,0xAA,0x89,0x73,
+    0x05,0x88,0xA9,0xAA,0x99,0x51,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,
+    0x9B,0x08,0x56,0x01,0x98,0xAA,0xAA,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,
+    0x80,0x99,0xBA,0xA9,0x30,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,0xB9,0xAA,
+    0x89,0x73,0x05,0x88,0xA9,0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,
+    0x99,0xAA,0x9B,0x19,0x56,0x01,0x98,0xAA,0xAA,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,
+    0x51,0x17,0x80,0x99,0xBA,0xA9,0x30,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,
+    0xAA,0xAA,0x09,0x72,0x05,0x88,0xA9,0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,
+    0x47,0x00,0x99,0xAA,0x9B,0x08,0x56,0x01,0x98,0xAA,0xAA,0x0A,0x73,0x14,0x98,0xA9,
+    0xAB,0x8A,0x51,0x17,0x80,0xA9,0xB9,0x99,0x38,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,
+    0x82,0x98,0xAA,0xAA,0x09,0x72,0x05,0x88,0xA9,0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,
+    0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x08,0x56,0x01,0x98,0xAA,0xAA,0x0A,0x73,0x14,
+    0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0xA9,0xB9,0x99,0x38,0x47,0x80,0x98,0xBA,0x9A,
+    0x19,0x65,0x82,0x98,0xAA,0xAA,0x09,0x72,0x05,0x88,0xA9,0xAA,0x89,0x50,0x16,0x80,
+    0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x08,0x56,0x01,0x98,0xAA,0xAA,0x0A,
+    0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0xA9,0xB9,0x99,0x38,0x47,0x80,0x98,
+    0xBA,0x9A,0x19,0x65,0x82,0x98,0xAA,0xAA,0x09,0x72,0x05,0x88,0xA9,0xAA,0x89,0x50,
+    0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x08,0x56,0x01,0x98,0xAA,
+    0xAA,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0xA9,0xB9,0x99,0x38,0x47,
+    0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,0xAA,0xAA,0x09,0x72,0x05,0x88,0xA9,0xAA,
+    0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x08,0x56,0x01,
+    0x98,0xAA,0xAA,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0xA9,0xB9,0x99,
+    0x38,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,0xAA,0xAA,0x09,0x72,0x05,0x88,
+    0xA9,0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x08,
+    0x56,0x01,0x98,0xAA,0xAA,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0xA9,
+    0xB9,0x99,0x38,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,0xAA,0xAA,0x09,0x72,
+    0x05,0x88,0xA9,0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,
+    0x9B,0x08,0x56,0x01,0x98,0xAA,0xAA,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,
+    0x80,0xA9,0xB9,0x99,0x38,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,0xAA,0xAA,
+    0x09,0x72,0x05,0x88,0xA9,0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,
+    0x99,0xAA,0x9B,0x08,0x56,0x01,0x98,0xAA,0xAA,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,
+    0x51,0x17,0x80,0xA9,0xB9,0x99,0x38,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,
+    0xAA,0xAA,0x09,0x72,0x05,0x88,0xA9,0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,
+    0x47,0x00,0x99,0xAA,0x9B,0x08,0x56,0x01,0x98,0xAA,0xAA,0x0A,0x73,0x14,0x98,0xA9,
+    0xAB,0x8A,0x51,0x17,0x80,0xA9,0xB9,0x99,0x38,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,
+    0x82,0x98,0xAA,0xAA,0x09,0x72,0x05,0x88,0xA9,0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,
+    0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x08,0x56,0x01,0x98,0xAA,0xAA,0x0A,0x73,0x14,
+    0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0xA9,0xB9,0x99,0x38,0x47,0x80,0x98,0xBA,0x9A,
+    0x19,0x65,0x82,0x98,0xAA,0xAA,0x09,0x72,0x05,0x88,0xA9,0xAA,0x89,0x50,0x16,0x80,
+    0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x08,0x56,0x01,0x98,0xAA,0xAA,0x0A,
+    0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0xA9,0xB9,0x99,0x38,0x47,0x80,0x98,
+    0xBA,0x9A,0x19,0x65,0x82,0x98,0xAA,0xAA,0x09,0x72,0x05,0x88,0xA9,0xAA,0x89,0x50,
+    0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x08,0x56,0x01,0x98,0xAA,
+    0xAA,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0xA9,0xB9,0x99,0x38,0x47,
+    0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,0xAA,0xAA,0x09,0x72,0x05,0x88,0xA9,0xAA,
+    0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0xAA,0x08,0x56,0x01,
+    0x98,0xAA,0x9B,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0xA9,0xB9,0x99,
+    0x38,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,0xAA,0xAA,0x09,0x72,0x05,0x88,
+    0xA9,0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0xAA,0x08,
+    0x56,0x01,0x98,0xAA,0x9B,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0xA9,
+    0xB9,0x99,0x38,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,0xAA,0xAA,0x09,0x72,
+    0x05,0x88,0xA9,0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,
+    0xAA,0x08,0x56,0x01,0x98,0xAA,0x9B,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,
+    0x80,0xA9,0xB9,0x99,0x38,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,0xB9,0xAA,
+    0x89,0x73,0x05,0x88,0xA9,0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,
+    0x99,0xAA,0x9B,0x08,0x56,0x01,0x98,0xAA,0xAA,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,
+    0x51,0x17,0x80,0xA9,0xB9,0x99,0x38,0x47,0x80,0xA8,0xB9,0x9A,0x19,0x56,0x01,0x98,
+    0xAA,0x9B,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0xA9,0xB9,0x99,0x38,
+    0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,0xAA,0xAA,0x09,0x72,0x05,0x88,0xA9,
+    0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0x9B,0x08,0x56,
+    0x01,0x98,0xAA,0xAA,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,0xA9,0xB9,
+    0x99,0x38,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,0xAA,0xAA,0x09,0x72,0x05,
+    0x88,0xA9,0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,0xAA,0xAA,
+    0x08,0x56,0x01,0x98,0xAA,0x9B,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,0x17,0x80,
+    0xA9,0xB9,0x99,0x38,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,0xAA,0xAA,0x09,
+    0x72,0x05,0x88,0xA9,0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,0x00,0x99,
+    0xAA,0xAA,0x08,0x56,0x01,0x98,0xAA,0x9B,0x0A,0x73,0x14,0x98,0xA9,0xAB,0x8A,0x51,
+    0x17,0x80,0xA9,0xB9,0x99,0x38,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,0x98,0xAA,
+    0xAA,0x09,0x72,0x05,0x88,0xA9,0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,0x20,0x47,
+    0x00,0x99,0xAA,0xAA,0x08,0x56,0x01,0x98,0xAA,0x9B,0x0A,0x73,0x14,0x98,0xA9,0xAB,
+    0x8A,0x51,0x17,0x80,0xA9,0xB9,0x99,0x38,0x47,0x80,0x98,0xBA,0x9A,0x19,0x65,0x82,
+    0x98,0xB9,0xAA,0x89,0x73,0x05,0x88,0xA9,0xAA,0x89,0x50,0x16,0x80,0xA9,0xAA,0x9A,
+    0x20,0x47,0x00,0x99,0xAA,0x9B,0x08,0x56,0x01,0x98,0xAA,0xAA,0x0A,0x73,0x14,0x98,
+    0xA9,0xAB,0x8A,0x51
+};
+
+const AdpcmSample samplePianoA6 = {samplePianoA6Data, 6600, 22000, 1760.00f, 5000, 6500, -2581, 66};
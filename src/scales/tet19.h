@@ -0,0 +1,26 @@
+// 19 equal divisions of the octave, Scala format
+const char scaleTet19[] = R"(! 19-tet.scl
+!
+19-TET
+ 19
+!
+ 63.15789
+ 126.31579
+ 189.47368
+ 252.63158
+ 315.78947
+ 378.94737
+ 442.10526
+ 505.26316
+ 568.42105
+ 631.57895
+ 694.73684
+ 757.89474
+ 821.05263
+ 884.21053
+ 947.36842
+ 1010.52632
+ 1073.68421
+ 1136.84211
+ 2/1
+)";
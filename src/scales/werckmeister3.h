@@ -0,0 +1,19 @@
+// Werckmeister III well temperament, Scala format
+const char scaleWerckmeister3[] = R"(! werck3.scl
+!
+Werck III
+ 12
+!
+ 90.225
+ 192.180
+ 294.135
+ 390.225
+ 498.045
+ 588.270
+ 696.090
+ 792.180
+ 888.270
+ 996.090
+ 1092.180
+ 2/1
+)";
@@ -0,0 +1,162 @@
+#ifndef TUNING_H
+#define TUNING_H
+
+#include "pin.h"
+#include "params.h"
+#include "bend.h"
+#include <math.h>
+#include <stdlib.h>
+
+// -------------------- Tuning Systems --------------------
+// A tuning is a list of degrees in cents above the root, the last one being
+// the period (1200 for octave-repeating scales). Selecting one rebuilds the
+// 96-entry noteFrequencies / notePhases / notePhaseIncs tables once; nothing
+// changes per sample. Keys map linearly onto degrees from the chosen root,
+// and the root sits at its 12-TET pitch for the reference A, so 12-TET at 440
+// reproduces the original table. Besides the built-in temperaments, Scala
+// (.scl) files compiled in from src/scales/ are parsed at start-up.
+const int TUNING_MAX_DEGREES = 32;
+const int TUNING_MAX_SCALES = 8;
+const int TUNING_NAME_LENGTH = 16;
+const int TUNING_A4_INDEX = 45;            // noteFrequencies[45] is A4
+const int TUNING_REF_MIN = 415;            // Reference A range in Hz
+const int TUNING_REF_MAX = 466;
+
+struct TuningScale {
+    char name[TUNING_NAME_LENGTH];
+    int degrees;                           // Notes per period
+    float cents[TUNING_MAX_DEGREES];       // Degrees 1..degrees; the last is the period
+};
+
+const TuningScale tuningBuiltins[] = {
+    {"12-TET", 12, {100, 200, 300, 400, 500, 600, 700, 800, 900, 1000, 1100, 1200}},
+    // 5-limit just: 16/15 9/8 6/5 5/4 4/3 45/32 3/2 8/5 5/3 9/5 15/8
+    {"Just", 12, {111.731f, 203.910f, 315.641f, 386.314f, 498.045f, 590.224f,
+                  701.955f, 813.686f, 884.359f, 1017.596f, 1088.269f, 1200}},
+    // Chain of pure fifths, wolf between G# and Eb
+    {"Pythag", 12, {90.225f, 203.910f, 294.135f, 407.820f, 498.045f, 611.730f,
+                    701.955f, 792.180f, 905.865f, 996.090f, 1109.775f, 1200}},
+    // Quarter-comma: pure major thirds, fifths narrowed by 5.38 cents
+    {"Meantone", 12, {76.049f, 193.157f, 310.265f, 386.314f, 503.422f, 579.471f,
+                      696.579f, 772.627f, 889.735f, 1006.843f, 1082.892f, 1200}}
+};
+const int TUNING_BUILTINS = sizeof(tuningBuiltins) / sizeof(tuningBuiltins[0]);
+
+#include "scales/werckmeister3.h"
+#include "scales/tet19.h"
+
+const char* const tuningScalaFiles[] = {scaleWerckmeister3, scaleTet19};
+
+TuningScale tuningScales[TUNING_MAX_SCALES];
+int tuningScaleCount = 0;
+
+// Next line of a Scala file that isn't a comment; false at the end
+bool scalaNextLine(const char*& text, const char*& line, int& length) {
+    while (*text) {
+        line = text;
+        while (*text && *text != '\n') text++;
+        length = text - line;
+        if (*text) text++;
+        if (line[0] != '!') return true;
+    }
+    return false;
+}
+
+// A pitch line: cents if it has a '.', otherwise a ratio "n/d" or "n"
+bool scalaParsePitch(const char* line, int length, float& cents) {
+    char buf[32];
+    length = std::min(length, (int)sizeof(buf) - 1);
+    memcpy(buf, line, length);
+    buf[length] = '\0';
+
+    char* p = buf;
+    while (*p == ' ' || *p == '\t') p++;
+    char* end;
+    if (strchr(p, '.')) {
+        cents = strtof(p, &end);
+        return end != p;
+    }
+    long num = strtol(p, &end, 10);
+    if (end == p || num <= 0) return false;
+    long den = 1;
+    if (*end == '/') {
+        char* start = end + 1;
+        den = strtol(start, &end, 10);
+        if (end == start || den <= 0) return false;
+    }
+    cents = 1200.0f * log2f((float)num / den);
+    return true;
+}
+
+// Parse a .scl file: description, degree count, then one pitch per line
+bool scalaParse(const char* text, TuningScale& scale) {
+    const char* line;
+    int length;
+    if (!scalaNextLine(text, line, length)) return false;
+    int nameLength = std::min(length, TUNING_NAME_LENGTH - 1);
+    memcpy(scale.name, line, nameLength);
+    scale.name[nameLength] = '\0';
+
+    if (!scalaNextLine(text, line, length)) return false;
+    scale.degrees = atoi(line);
+    if (scale.degrees < 1 || scale.degrees > TUNING_MAX_DEGREES) return false;
+
+    for (int d = 0; d < scale.degrees; d++) {
+        if (!scalaNextLine(text, line, length)) return false;
+        if (!scalaParsePitch(line, length, scale.cents[d])) return false;
+    }
+    return scale.cents[scale.degrees - 1] > 0.0f;
+}
+
+// Fill noteFrequencies for a scale and rebuild the phase tables from it
+void tuningApply(int system, int root, int reference) {
+    const TuningScale& scale = tuningScales[constrain(system, 0, tuningScaleCount - 1)];
+    float period = scale.cents[scale.degrees - 1];
+    float rootFrequency = reference * exp2f((root - TUNING_A4_INDEX) / 12.0f);
+
+    for (int i = 0; i < 96; i++) {
+        int steps = i - root;
+        int periods = (steps >= 0) ? steps / scale.degrees : -((scale.degrees - 1 - steps) / scale.degrees);
+        int degree = steps - periods * scale.degrees;
+        float cents = periods * period + (degree ? scale.cents[degree - 1] : 0.0f);
+        noteFrequencies[i] = rootFrequency * exp2f(cents / 1200.0f);
+    }
+    generatePhaseLUT();
+    bendApplyRatio(pitchBendRatio);
+}
+
+// After bendInit(); unreadable Scala files are skipped
+void tuningInit() {
+    for (int s = 0; s < TUNING_BUILTINS; s++) tuningScales[tuningScaleCount++] = tuningBuiltins[s];
+    for (const char* file : tuningScalaFiles) {
+        if (tuningScaleCount == TUNING_MAX_SCALES) break;
+        if (scalaParse(file, tuningScales[tuningScaleCount])) tuningScaleCount++;
+    }
+    tuningApply(settings.tuning.system, settings.tuning.root, settings.tuning.reference);
+}
+
+// Audio task, control rate
+void updateTuningParams() {
+    if (paramChanged(PARAM_TUNING)) {
+        tuningApply(backendSettings.tuning.system, backendSettings.tuning.root, backendSettings.tuning.reference);
+    }
+}
+
+// -------------------- Tuning Sync over CAN --------------------
+// 'S' message from the master: system, root, reference A - TUNING_REF_MIN.
+// Every board resolves keys through the same table, so boards that join or
+// take over as master play in the same tuning.
+void tuningMessage(volatile uint8_t* msg) {
+    msg[0] = 'S';
+    msg[1] = settings.tuning.system;
+    msg[2] = settings.tuning.root;
+    msg[3] = settings.tuning.reference - TUNING_REF_MIN;
+}
+
+void tuningReceive(const uint8_t* msg) {
+    writeParam(settings.tuning.system, constrain((int)msg[1], 0, tuningScaleCount - 1), PARAM_TUNING);
+    writeParam(settings.tuning.root, constrain((int)msg[2], 0, 11), PARAM_TUNING);
+    writeParam(settings.tuning.reference, constrain(msg[3] + TUNING_REF_MIN, TUNING_REF_MIN, TUNING_REF_MAX), PARAM_TUNING);
+}
+
+#endif
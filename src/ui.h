@@ -3,141 +3,429 @@
 
 #include "pin.h"
 #include "effect.h"
+#include "fm.h"
+#include "morph.h"
+#include "unison.h"
+#include "drums.h"
+#include "additive.h"
+#include "bend.h"
+#include "tuning.h"
+#include "modmatrix.h"
+
+// ---------- Menu Pages ----------
+// The UI is a small state machine: the home screen, the menu grid, and one
+// state per page. Each page is a static MenuPageInfo giving its grid label,
+// its renderer and what knobs 1-3 (and knob 1's click) edit, so dispatch is
+// one indexed lookup and a new page is one table entry.
+enum MenuPage : uint8_t {
+    PAGE_HOME, PAGE_GRID,
+    PAGE_MET, PAGE_ADSR, PAGE_LPF, PAGE_DIS, PAGE_CHO, PAGE_REV, PAGE_DLY, PAGE_EQ, PAGE_FM,
+    PAGE_FME, PAGE_MOR, PAGE_UNI, PAGE_DRM, PAGE_ADD, PAGE_BND, PAGE_TUN, PAGE_LFO, PAGE_MOD, PAGE_EXIT,
+    MENU_PAGES
+};
 
 // ---------- Menu Constants ----------
-const int PAGE_HEIGHT = 48;
-const int ITEM_SPACING = 8;
-int menu_offset = 0;
-int selected_option = 0;
-const int total_menu_items = 7;
+const int PAGE_HEIGHT = 32;                              // Visible rows of the SSD1305
+const int MENU_COLUMNS = 3;
+const int MENU_ROW_SPACING = 11;
+const int MENU_FIRST_Y = 14;                             // Baseline of grid row 0
+const int MENU_TOP_Y = 10;                               // Highest baseline a label fits at
+const int MENU_VISIBLE_ROWS = (PAGE_HEIGHT - MENU_FIRST_Y) / MENU_ROW_SPACING + 1;
+int menu_offset = 0;                                     // Pixels scrolled, whole rows
+const int MENU_FIRST_ITEM = PAGE_MET;                    // Grid item 0
+const int total_menu_items = MENU_PAGES - MENU_FIRST_ITEM;
+
+const int8_t PARAM_NONE = -1;                            // Setting read directly, no version
+
+// One knob's effect: value += increment * step within [min, max]. With
+// `select` set, the field is value[*select * stride], e.g. the LFO being edited.
+struct KnobBinding {
+    int* value;                                          // Null: knob unused
+    int min;
+    int max;
+    int step;
+    int8_t param;
+    const int* select;
+    int stride;
+};
+
+// Knob 1's click state copied into an On/Off flag
+struct ToggleBinding {
+    bool* flag;
+    int8_t param;
+};
+
+struct MenuPageInfo {
+    const char* label;                                   // Grid label
+    void (*render)(const setting&);
+    ToggleBinding toggle;
+    KnobBinding knobs[3];                                // Knobs 1-3
+    void (*after)();                                     // Limits the table can't express
+};
+
+constexpr KnobBinding bindKnob(int* value, int min, int max, int8_t param = PARAM_NONE, int step = 1) {
+    return {value, min, max, step, param, nullptr, 0};
+}
+
+template <typename T>
+constexpr KnobBinding bindSelected(int* first, const int* select, int min, int max, int8_t param) {
+    return {first, min, max, 1, param, select, (int)(sizeof(T) / sizeof(int))};
+}
+
+constexpr KnobBinding NO_KNOB = {nullptr, 0, 0, 0, PARAM_NONE, nullptr, 0};
+constexpr ToggleBinding NO_TOGGLE = {nullptr, PARAM_NONE};
 
-std::string convertBoolToStr(bool val) {
+const char* convertBoolToStr(bool val) {
     return val ? "On" : "Off";
 }
 
+// Integer at (x, y) without building a std::string
+void drawNumber(int x, int y, int value, const char* suffix = "") {
+    char text[16];
+    snprintf(text, sizeof(text), "%d%s", value, suffix);
+    u8g2.drawStr(x, y, text);
+}
+
 // ---------- Page Render Functions ----------
-void emptyPage() {
+// Called by the display task with its UI snapshot
+void emptyPage(const setting&) {
     u8g2.drawStr(10, 14, "Empty Page");
 }
 
-void metPage(Metronome m) {
-    sysState.currentMenu = "Met";
+void metPage(const setting& s) {
     u8g2.drawStr(10, 7, "Metronome");
     u8g2.drawStr(10, 14, "State: ");
-    u8g2.drawStr(50, 14, convertBoolToStr(m.on).c_str());
+    u8g2.drawStr(50, 14, convertBoolToStr(s.metronome.on));
     u8g2.drawStr(10, 21, "Speed: ");
-    u8g2.drawStr(50, 21, std::to_string(m.speed).c_str());
+    drawNumber(50, 21, s.metronome.speed);
 }
 
-void adsrPage(ADSR a) {
-    sysState.currentMenu = "ADSR";
+void adsrPage(const setting& s) {
     u8g2.drawStr(10, 7, "ADSR Envelope");
     u8g2.drawStr(10, 14, "On");
     u8g2.drawStr(40, 14, "A");
     u8g2.drawStr(70, 14, "D");
     u8g2.drawStr(100, 14, "S");
 
-
-    u8g2.setCursor(10, 21); u8g2.print(convertBoolToStr(a.on).c_str());
-    u8g2.setCursor(40, 21); u8g2.print(std::to_string(a.attack).c_str());
-    u8g2.setCursor(70, 21); u8g2.print(std::to_string(a.decay).c_str());
-    u8g2.setCursor(100, 21); u8g2.print(std::to_string(a.sustain).c_str());
+    u8g2.drawStr(10, 21, convertBoolToStr(s.adsr.on));
+    drawNumber(40, 21, s.adsr.attack);
+    drawNumber(70, 21, s.adsr.decay);
+    drawNumber(100, 21, s.adsr.sustain);
 }
 
-void lpfPage(Lowpass lpf) {
-    sysState.currentMenu = "LPF";
+void lpfPage(const setting& s) {
     u8g2.drawStr(10, 7, "LowPass Filter");
     u8g2.drawStr(10, 14, "State: ");
-    u8g2.drawStr(50, 14, convertBoolToStr(lpf.on).c_str());
+    u8g2.drawStr(50, 14, convertBoolToStr(s.lowpass.on));
     u8g2.drawStr(10, 21, "Freq: ");
-    u8g2.drawStr(50, 21, std::to_string(lpf.freq).c_str());
+    drawNumber(50, 21, s.lowpass.freq);
 }
 
-void reverbPage() {
-    sysState.currentMenu = "Reverb";
-    u8g2.drawStr(10, 7, "Reverb Effect");
+// Reverb, distortion and chorus share a layout
+void effectPage(const char* title, bool on, int strength) {
+    u8g2.drawStr(10, 7, title);
     u8g2.drawStr(30, 14, "State: ");
-    u8g2.drawStr(70, 14, convertBoolToStr(settings.reverb_on).c_str());
+    u8g2.drawStr(70, 14, convertBoolToStr(on));
     u8g2.drawStr(10, 21, "Strength: ");
-    u8g2.drawStr(70, 21, std::to_string(settings.reverb_strength).c_str());
+    drawNumber(70, 21, strength);
 }
 
-void distortionPage() {
-    sysState.currentMenu = "Distortion";
-    u8g2.drawStr(10, 7, "Distortion Effect");
-    u8g2.drawStr(30, 14, "State: ");
-    u8g2.drawStr(70, 14, convertBoolToStr(settings.distortion_on).c_str());
-    u8g2.drawStr(10, 21, "Strength: ");
-    u8g2.drawStr(70, 21, std::to_string(settings.distortion_strength).c_str());
+void reverbPage(const setting& s) {
+    effectPage("Reverb Effect", s.reverb_on, s.reverb_strength);
+}
+
+void distortionPage(const setting& s) {
+    effectPage("Distortion Effect", s.distortion_on, s.distortion_strength);
+}
+
+void chorusPage(const setting& s) {
+    effectPage("Chorus Effect", s.chorus_on, s.chorus_strength);
 }
 
-void chorusPage() {
-    sysState.currentMenu = "Chorus";
-    u8g2.drawStr(10, 7, "Chorus Effect");
+void delayPage(const setting& s) {
+    u8g2.drawStr(10, 7, "Delay Effect");
     u8g2.drawStr(30, 14, "State: ");
-    u8g2.drawStr(70, 14, convertBoolToStr(settings.chorus_on).c_str());
-    u8g2.drawStr(10, 21, "Strength: ");
-    u8g2.drawStr(70, 21, std::to_string(settings.chorus_strength).c_str());
+    u8g2.drawStr(70, 14, convertBoolToStr(s.delay_on));
+    u8g2.drawStr(10, 21, "Feedback: ");
+    drawNumber(70, 21, s.delay_strength);
+    u8g2.drawStr(10, 28, "Time: ");
+    drawNumber(70, 28, s.delay_division, "/4 beat");
+}
+
+void eqPage(const setting& s) {
+    u8g2.drawStr(10, 7, "Master EQ (dB)");
+    u8g2.drawStr(10, 14, "On");
+    u8g2.drawStr(40, 14, "Low");
+    u8g2.drawStr(70, 14, "Mid");
+    u8g2.drawStr(100, 14, "High");
+
+    u8g2.drawStr(10, 21, convertBoolToStr(s.eq.on));
+    for (int i = 0; i < 3; i++) {
+        drawNumber(40 + 30 * i, 21, s.eq.gain[i] * 3);
+    }
+}
+
+void fmPage(const setting& s) {
+    u8g2.drawStr(10, 7, "FM Voice");
+    u8g2.drawStr(10, 14, "Alg");
+    u8g2.drawStr(50, 14, "Ratio");
+    u8g2.drawStr(90, 14, "Index");
+
+    drawNumber(10, 21, s.fm.algorithm);
+    drawNumber(50, 21, s.fm.ratio);
+    drawNumber(90, 21, s.fm.index);
+}
+
+void fmEnvPage(const setting& s) {
+    u8g2.drawStr(10, 7, "FM Envelopes");
+    u8g2.drawStr(10, 14, "Op");
+    u8g2.drawStr(50, 14, "Env");
+
+    drawNumber(10, 21, s.fm.opEdit + 1);
+    u8g2.drawStr(50, 21, fmEnvNames[s.fm.env[s.fm.opEdit]]);
+}
+
+void morphPage(const setting& s) {
+    u8g2.drawStr(10, 7, "Wave Morph");
+    u8g2.drawStr(10, 14, "Pos");
+    u8g2.drawStr(50, 14, "Source");
+    u8g2.drawStr(90, 14, "Rate");
+
+    drawNumber(10, 21, s.morph.position);
+    u8g2.drawStr(50, 21, morphSourceNames[s.morph.source]);
+    drawNumber(90, 21, s.morph.rate);
+}
+
+void unisonPage(const setting& s) {
+    u8g2.drawStr(10, 7, "Unison");
+    u8g2.drawStr(10, 14, "Voices");
+    u8g2.drawStr(50, 14, "Detune");
+
+    drawNumber(10, 21, s.unison.voices);
+    drawNumber(50, 21, s.unison.detune * (int)UNISON_CENTS_PER_STEP);
+}
+
+void drumPage(const setting& s) {
+    u8g2.drawStr(10, 7, "Drums");
+    u8g2.drawStr(10, 14, "On");
+    u8g2.drawStr(40, 14, "Board");
+    u8g2.drawStr(80, 14, "Pattern");
+
+    u8g2.drawStr(10, 21, convertBoolToStr(s.drums.on));
+    if (s.drums.board) drawNumber(40, 21, s.drums.board);
+    else u8g2.drawStr(40, 21, "-");
+    if (s.drums.pattern) drawNumber(80, 21, s.drums.pattern);
+    else u8g2.drawStr(80, 21, "Off");
+}
+
+void additivePage(const setting& s) {
+    u8g2.drawStr(10, 7, "Additive");
+    u8g2.drawStr(10, 14, "Timbre");
+
+    u8g2.drawStr(10, 21, additiveTimbreNames[s.additive.timbre]);
+}
+
+void bendPage(const setting& s) {
+    u8g2.drawStr(10, 7, "Pitch Bend");
+    u8g2.drawStr(10, 14, "Range");
+    u8g2.drawStr(50, 14, "Rate");
+    u8g2.drawStr(90, 14, "Depth");
+
+    drawNumber(10, 21, s.bend.range);
+    drawNumber(50, 21, s.bend.rate);
+    drawNumber(90, 21, s.bend.depth * (int)BEND_VIBRATO_CENTS_PER_STEP);
+}
+
+void tuningPage(const setting& s) {
+    u8g2.drawStr(10, 7, "Tuning");
+    u8g2.drawStr(10, 14, "System");
+    u8g2.drawStr(70, 14, "Root");
+    u8g2.drawStr(95, 14, "A=");
+
+    u8g2.drawStr(10, 21, tuningScales[s.tuning.system].name);
+    u8g2.drawStr(70, 21, noteNames[s.tuning.root]);
+    drawNumber(95, 21, s.tuning.reference);
+}
+
+void lfoPage(const setting& s) {
+    u8g2.drawStr(10, 7, "LFOs");
+    u8g2.drawStr(10, 14, "LFO");
+    u8g2.drawStr(50, 14, "Shape");
+    u8g2.drawStr(90, 14, "Rate");
+
+    const LFO& lfo = s.mod.lfo[s.mod.lfoEdit];
+    drawNumber(10, 21, s.mod.lfoEdit + 1);
+    u8g2.drawStr(50, 21, lfoShapeNames[lfo.shape]);
+    drawNumber(90, 21, lfo.rate);
+}
+
+void modPage(const setting& s) {
+    u8g2.drawStr(10, 7, "Mod Matrix");
+    u8g2.drawStr(10, 14, "Source");
+    u8g2.drawStr(50, 14, "Dest");
+    u8g2.drawStr(90, 14, "Depth");
+
+    const ModRoute& route = s.mod.route[s.mod.sourceEdit];
+    u8g2.drawStr(10, 21, modSourceNames[s.mod.sourceEdit]);
+    u8g2.drawStr(50, 21, modDestNames[route.dest]);
+    drawNumber(90, 21, route.depth);
+}
+
+// The scale count is only known once the Scala files are parsed. Runs before
+// the page's versions are bumped, so it only clamps.
+void tuningLimits() {
+    settings.tuning.system = std::min(settings.tuning.system, tuningScaleCount - 1);
+}
+
+// ---------- Page Table ----------
+const MenuPageInfo menuPages[MENU_PAGES] = {
+    // Home: the bottom bar's wave, octave and volume
+    {"", nullptr, NO_TOGGLE,
+     {bindKnob(&settings.waveIndex, 0, NUM_WAVES - 1), bindKnob(&settings.tune, 0, 8), bindKnob(&settings.volume, 0, 8)},
+     nullptr},
+    {"", nullptr, NO_TOGGLE, {NO_KNOB, NO_KNOB, NO_KNOB}, nullptr},
+    // The delay time follows the metronome beat
+    {"MET", metPage, {&settings.metronome.on, PARAM_NONE},
+     {NO_KNOB, bindKnob(&settings.metronome.speed, 1, 8, PARAM_DELAY), NO_KNOB},
+     nullptr},
+    {"ADSR", adsrPage, {&settings.adsr.on, PARAM_NONE},
+     {bindKnob(&settings.adsr.attack, 0, 50), bindKnob(&settings.adsr.decay, 0, 50), bindKnob(&settings.adsr.sustain, 0, 50)},
+     nullptr},
+    {"LPF", lpfPage, {&settings.lowpass.on, PARAM_LPF},
+     {NO_KNOB, bindKnob(&settings.lowpass.freq, 500, 2000, PARAM_LPF, 100), NO_KNOB},
+     nullptr},
+    {"DIS", distortionPage, {&settings.distortion_on, PARAM_DISTORTION},
+     {NO_KNOB, bindKnob(&settings.distortion_strength, 0, 10, PARAM_DISTORTION), NO_KNOB},
+     nullptr},
+    {"CHO", chorusPage, {&settings.chorus_on, PARAM_CHORUS},
+     {NO_KNOB, bindKnob(&settings.chorus_strength, 0, 10, PARAM_CHORUS), NO_KNOB},
+     nullptr},
+    {"REV", reverbPage, {&settings.reverb_on, PARAM_REVERB},
+     {NO_KNOB, bindKnob(&settings.reverb_strength, 0, 10, PARAM_REVERB), NO_KNOB},
+     nullptr},
+    {"DLY", delayPage, {&settings.delay_on, PARAM_DELAY},
+     {NO_KNOB, bindKnob(&settings.delay_strength, 0, 10, PARAM_DELAY), bindKnob(&settings.delay_division, 1, 4, PARAM_DELAY)},
+     nullptr},
+    {"EQ", eqPage, {&settings.eq.on, PARAM_EQ},
+     {bindKnob(&settings.eq.gain[0], -4, 4, PARAM_EQ), bindKnob(&settings.eq.gain[1], -4, 4, PARAM_EQ),
+      bindKnob(&settings.eq.gain[2], -4, 4, PARAM_EQ)},
+     nullptr},
+    {"FM", fmPage, NO_TOGGLE,
+     {bindKnob(&settings.fm.algorithm, 0, 3, PARAM_FM), bindKnob(&settings.fm.ratio, 1, 8, PARAM_FM),
+      bindKnob(&settings.fm.index, 0, 10, PARAM_FM)},
+     nullptr},
+    // Knob 1 picks the operator whose envelope knob 2 sets
+    {"FME", fmEnvPage, NO_TOGGLE,
+     {bindKnob(&settings.fm.opEdit, 0, FM_OPERATORS - 1),
+      bindSelected<int>(&settings.fm.env[0], &settings.fm.opEdit, 0, FM_ENV_PRESETS - 1, PARAM_FM), NO_KNOB},
+     nullptr},
+    {"MOR", morphPage, NO_TOGGLE,
+     {bindKnob(&settings.morph.position, 0, MORPH_MAX_POSITION, PARAM_MORPH),
+      bindKnob(&settings.morph.source, 0, MORPH_SOURCES - 1, PARAM_MORPH), bindKnob(&settings.morph.rate, 1, 10, PARAM_MORPH)},
+     nullptr},
+    {"UNI", unisonPage, NO_TOGGLE,
+     {bindKnob(&settings.unison.voices, 1, UNISON_MAX, PARAM_UNISON), bindKnob(&settings.unison.detune, 0, 10, PARAM_UNISON),
+      NO_KNOB},
+     nullptr},
+    {"DRM", drumPage, {&settings.drums.on, PARAM_NONE},
+     {NO_KNOB, bindKnob(&settings.drums.board, 0, 3), bindKnob(&settings.drums.pattern, 0, DRUM_PATTERNS - 1)},
+     nullptr},
+    {"ADD", additivePage, NO_TOGGLE,
+     {bindKnob(&settings.additive.timbre, 0, ADD_TIMBRES - 1, PARAM_ADDITIVE), NO_KNOB, NO_KNOB},
+     nullptr},
+    {"BND", bendPage, NO_TOGGLE,
+     {bindKnob(&settings.bend.range, 1, 12, PARAM_BEND), bindKnob(&settings.bend.rate, 1, 10, PARAM_BEND),
+      bindKnob(&settings.bend.depth, 0, 10, PARAM_BEND)},
+     nullptr},
+    {"TUN", tuningPage, NO_TOGGLE,
+     {bindKnob(&settings.tuning.system, 0, TUNING_MAX_SCALES - 1, PARAM_TUNING),
+      bindKnob(&settings.tuning.root, 0, 11, PARAM_TUNING),
+      bindKnob(&settings.tuning.reference, TUNING_REF_MIN, TUNING_REF_MAX, PARAM_TUNING)},
+     tuningLimits},
+    // Knob 1 picks the LFO / source the other two edit
+    {"LFO", lfoPage, NO_TOGGLE,
+     {bindKnob(&settings.mod.lfoEdit, 0, MOD_LFOS - 1),
+      bindSelected<LFO>(&settings.mod.lfo[0].shape, &settings.mod.lfoEdit, 0, LFO_SHAPES - 1, PARAM_MOD),
+      bindSelected<LFO>(&settings.mod.lfo[0].rate, &settings.mod.lfoEdit, 1, 20, PARAM_MOD)},
+     nullptr},
+    {"MOD", modPage, NO_TOGGLE,
+     {bindKnob(&settings.mod.sourceEdit, 0, MOD_SOURCES - 1),
+      bindSelected<ModRoute>(&settings.mod.route[0].dest, &settings.mod.sourceEdit, 0, MOD_DESTS - 1, PARAM_MOD),
+      bindSelected<ModRoute>(&settings.mod.route[0].depth, &settings.mod.sourceEdit, -10, 10, PARAM_MOD)},
+     nullptr},
+    {"exit", emptyPage, NO_TOGGLE, {NO_KNOB, NO_KNOB, NO_KNOB}, nullptr}
+};
+
+// Scroll offset that keeps grid item index on screen, moving by whole rows
+// and only as far as needed
+int menuScroll(int offset, int index) {
+    int row = index / MENU_COLUMNS;
+    int firstRow = offset / MENU_ROW_SPACING;
+    if (row < firstRow) firstRow = row;
+    else if (row >= firstRow + MENU_VISIBLE_ROWS) firstRow = row - MENU_VISIBLE_ROWS + 1;
+    return firstRow * MENU_ROW_SPACING;
+}
+
+// Label baseline of a grid item with the grid scrolled by offset
+inline int menuItemY(int item, int offset) {
+    return MENU_FIRST_Y + MENU_ROW_SPACING * (item / MENU_COLUMNS) - offset;
+}
+
+inline bool menuItemVisible(int y) {
+    return y >= MENU_TOP_Y && y < PAGE_HEIGHT;
+}
+
+// Page for a grid item
+inline MenuPage menuItemPage(int item) {
+    return (MenuPage)(MENU_FIRST_ITEM + item);
 }
 
 // ---------- Main Menu Rendering Dispatcher ----------
-void menu(int option, setting s) {
+void menu(MenuPage page, const setting& s) {
     u8g2.clearBuffer();
     u8g2.setFont(u8g2_font_5x8_tr);
-    switch(option) {
-        case 0: metPage(s.metronome); break;
-        case 1: adsrPage(s.adsr); break;
-        case 2: lpfPage(s.lowpass); break;
-        case 3: distortionPage(); break;
-        case 4: chorusPage(); break;
-        case 5: reverbPage(); break;
-        case 6: emptyPage(); break;
-        default: emptyPage(); break;
-    }
+    if (menuPages[page].render) menuPages[page].render(s);
 }
 
 // ---------- Menu Setting Update Dispatcher ----------
-void update_menu_settings(std::string option, int& currentTune) {
-    if (option == "Main") {
-        settings.volume += sysState.knobValues[3].lastIncrement;
-        settings.tune += sysState.knobValues[2].lastIncrement;
-        settings.waveIndex += sysState.knobValues[1].lastIncrement;
-        settings.volume = constrain(settings.volume, 0, 8);
-        settings.tune = constrain(settings.tune, 0, 8);
-        settings.waveIndex = constrain(settings.waveIndex, 0, 8);
-        currentTune = settings.tune;
-    } else if (option == "Effect") {
-        settings.effectType += sysState.knobValues[1].lastIncrement;
-        settings.effectType = constrain(settings.effectType, 0, 2);
-    } else if (option == "Reverb") {
-        settings.reverb_on = sysState.knobValues[1].clickState;
-        settings.reverb_strength += sysState.knobValues[2].lastIncrement;
-        settings.reverb_strength = constrain(settings.reverb_strength, 0, 10);
-    } else if (option == "Distortion") {
-        settings.distortion_on = sysState.knobValues[1].clickState;
-        settings.distortion_strength += sysState.knobValues[2].lastIncrement;
-        settings.distortion_strength = constrain(settings.distortion_strength, 0, 10);
-    } else if (option == "Chorus") {
-        settings.chorus_on = sysState.knobValues[1].clickState;
-        settings.chorus_strength += sysState.knobValues[2].lastIncrement;
-        settings.chorus_strength = constrain(settings.chorus_strength, 0, 10);
-    } else if (option == "Met") {
-        settings.metronome.on = sysState.knobValues[1].clickState;
-        settings.metronome.speed += sysState.knobValues[2].lastIncrement;
-        settings.metronome.speed = constrain(settings.metronome.speed, 1, 8);
-    } else if (option == "ADSR") {
-        settings.adsr.on = sysState.knobValues[1].clickState;
-        settings.adsr.attack += sysState.knobValues[1].lastIncrement;
-        settings.adsr.decay += sysState.knobValues[2].lastIncrement;
-        settings.adsr.sustain += sysState.knobValues[3].lastIncrement;
-        settings.adsr.attack = constrain(settings.adsr.attack, 0, 50);
-        settings.adsr.decay = constrain(settings.adsr.decay, 0, 50);
-        settings.adsr.sustain = constrain(settings.adsr.sustain, 0, 50);
-    } else if (option == "LPF") {
-        settings.lowpass.on = sysState.knobValues[1].clickState;
-        settings.lowpass.freq += sysState.knobValues[2].lastIncrement * 100;
-        settings.lowpass.freq = constrain(settings.lowpass.freq, 500, 2000);
+static_assert(PARAM_COUNT <= 32, "one bit per ParamId");
+
+inline int* knobField(const KnobBinding& binding) {
+    return binding.select ? binding.value + *binding.select * binding.stride : binding.value;
+}
+
+// Scan task, every 20 ms with the settings mutex held. Knobs write their
+// fields, the page's limit hook clamps them, and only then is each group
+// whose fields ended up different bumped, once.
+void update_menu_settings(MenuPage page, int& currentTune) {
+    const MenuPageInfo& info = menuPages[page];
+    if (info.toggle.flag) {
+        bool on = sysState.knobValues[1].clickState;
+        if (info.toggle.param == PARAM_NONE) *info.toggle.flag = on;
+        else writeParam(*info.toggle.flag, on, (ParamId)info.toggle.param);
+    }
+
+    int before[3];
+    for (int k = 0; k < 3; k++) {
+        const KnobBinding& binding = info.knobs[k];
+        if (!binding.value) continue;
+        int* field = knobField(binding);
+        before[k] = *field;
+        int increment = sysState.knobValues[k + 1].lastIncrement;
+        if (increment != 0) *field = constrain(*field + increment * binding.step, binding.min, binding.max);
+    }
+    if (info.after) info.after();
+
+    uint32_t changed = 0;
+    for (int k = 0; k < 3; k++) {
+        const KnobBinding& binding = info.knobs[k];
+        if (!binding.value || binding.param == PARAM_NONE) continue;
+        if (*knobField(binding) != before[k]) changed |= 1u << binding.param;
+    }
+    for (int id = 0; id < PARAM_COUNT; id++) {
+        if (changed >> id & 1) touchParam((ParamId)id);
     }
+    currentTune = settings.tune;
 }
 
 #endif
@@ -0,0 +1,52 @@
+#ifndef UISNAPSHOT_H
+#define UISNAPSHOT_H
+
+#include "pin.h"
+
+// -------------------- UI Snapshot --------------------
+// Everything the display draws, copied by the input tasks after each update
+// while they already hold the mutexes. The display renders from its own copy
+// and takes no lock, so a slow frame can't hold up key scanning or decoding.
+// Three buffers are swapped by index: the writer fills `back` and exchanges
+// it with `middle`, the display exchanges `front` with `middle` when a fresh
+// one is waiting. Neither side ever waits, and the display always sees a
+// complete snapshot.
+struct UiSnapshot {
+    setting values;
+    uint32_t inputs = INPUT_IDLE;
+    int posId = 0;
+    bool menuOpen = false;                      // Knob 0 clicked: the grid or a page
+    bool pageOpen = false;                      // Joystick pressed: the selected page
+};
+
+const uint8_t UI_SNAPSHOT_FRESH = 0x80;         // Set in `middle` until the display takes it
+
+struct {
+    UiSnapshot buffers[3];
+    uint8_t back = 0;                           // Writer's, under settings.mutex
+    uint8_t middle = 1;                         // Last published
+    uint8_t front = 2;                          // Display's
+} uiSnapshots;
+
+// Writers, holding sysState.mutex and settings.mutex
+void uiPublish() {
+    UiSnapshot& snapshot = uiSnapshots.buffers[uiSnapshots.back];
+    snapshot.values = settings;
+    snapshot.inputs = sysState.inputs;
+    snapshot.posId = sysState.posId;
+    snapshot.menuOpen = sysState.knobValues[0].clickState;
+    snapshot.pageOpen = sysState.joystickState;
+    uint8_t previous = __atomic_exchange_n(&uiSnapshots.middle, uiSnapshots.back | UI_SNAPSHOT_FRESH, __ATOMIC_ACQ_REL);
+    uiSnapshots.back = previous & ~UI_SNAPSHOT_FRESH;
+}
+
+// Display task: the latest snapshot, valid until the next call
+const UiSnapshot& uiTake() {
+    if (__atomic_load_n(&uiSnapshots.middle, __ATOMIC_RELAXED) & UI_SNAPSHOT_FRESH) {
+        uint8_t latest = __atomic_exchange_n(&uiSnapshots.middle, uiSnapshots.front, __ATOMIC_ACQ_REL);
+        uiSnapshots.front = latest & ~UI_SNAPSHOT_FRESH;
+    }
+    return uiSnapshots.buffers[uiSnapshots.front];
+}
+
+#endif
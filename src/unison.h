@@ -0,0 +1,106 @@
+#ifndef UNISON_H
+#define UNISON_H
+
+#include "pin.h"
+#include "params.h"
+#include "bend.h"
+#include <math.h>
+
+// -------------------- Unison Oscillator Bank --------------------
+// Each held note plays up to UNISON_MAX detuned copies of the current table
+// wave, spread evenly across +/- the detune amount and summed to mono. The
+// board has OUTL_PIN and OUTR_PIN, but the audio path is one sample stream
+// written to OUTR_PIN; a stereo spread would need a second buffer and a
+// second write in sampleISR. The copies are a bank of 32-bit phase
+// accumulators in one contiguous array per note, stepped together in a single
+// branch-free inner loop. Copies x held notes is capped at
+// UNISON_OSC_BUDGET so a full chord still meets the block deadline; see
+// unisonTime() in test/test.h for the per-oscillator cost behind it.
+const int UNISON_MAX = 7;
+const int UNISON_OSC_BUDGET = 48;
+const float UNISON_CENTS_PER_STEP = 5.0f;     // Detune 0..10 -> up to +/-50 cents
+
+float unisonRatios[UNISON_MAX];
+int unisonCopies = 1;
+
+struct {
+    uint32_t phases[96][UNISON_MAX];
+    bool wasActive[96];
+    uint32_t rng = 0x2545F491;
+} unisonBank;
+
+// Called once per block; returns true if unison is engaged
+bool updateUnisonParams() {
+    if (paramChanged(PARAM_UNISON)) {
+        unisonCopies = constrain(backendSettings.unison.voices, 1, UNISON_MAX);
+        float spread = backendSettings.unison.detune * UNISON_CENTS_PER_STEP;
+        for (int k = 0; k < unisonCopies; k++) {
+            float cents = (unisonCopies == 1) ? 0.0f : spread * (2.0f * k / (unisonCopies - 1) - 1.0f);
+            unisonRatios[k] = powf(2.0f, cents / 1200.0f);
+        }
+    }
+    return unisonCopies > 1;
+}
+
+// Render every held note into block (8-bit units, averaged over notes like
+// mixActiveNotes). A null table plays the sawtooth. Returns the held count.
+int unisonRenderBlock(float* block, int length, int volume, const float* table, bool horn) {
+    static uint8_t notesHeld[96];           // Backend only; kept off its 1 KB stack
+    int held = 0;
+    for (int i = 0; i < 96; ++i) {
+        bool isActive = __atomic_load_n(&notes.notes[i].active, __ATOMIC_RELAXED);
+        // Free-running start phases keep the copies from starting in step
+        if (isActive && !unisonBank.wasActive[i]) {
+            for (int k = 0; k < UNISON_MAX; k++) {
+                uint32_t x = unisonBank.rng;
+                x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+                unisonBank.rng = x;
+                unisonBank.phases[i][k] = x;
+            }
+        }
+        unisonBank.wasActive[i] = isActive;
+        if (isActive) notesHeld[held++] = i;
+    }
+
+    memset(block, 0, length * sizeof(float));
+    if (held == 0) return 0;
+
+    // Over budget, keep the innermost copies of the spread
+    int copies = std::max(1, std::min(unisonCopies, UNISON_OSC_BUDGET / held));
+    int firstCopy = (unisonCopies - copies) / 2;
+    const float copyScale = 1.0f / copies;
+    const float sawScale = 1.0f / 16777216.0f;
+    uint32_t incs[UNISON_MAX];
+
+    for (int h = 0; h < held; h++) {
+        int i = notesHeld[h];
+        uint32_t* phases = unisonBank.phases[i];
+        for (int k = 0; k < copies; k++) {
+            incs[k] = (uint32_t)(bentPhaseIncs[i] * unisonRatios[firstCopy + k]);
+        }
+
+        for (int n = 0; n < length; n++) {
+            float sum = 0.0f;
+            if (table) {
+                for (int k = 0; k < copies; k++) {
+                    phases[k] += incs[k];
+                    sum += table[phases[k] >> 24];     // 256-entry tables
+                }
+            } else {
+                for (int k = 0; k < copies; k++) {
+                    phases[k] += incs[k];
+                    sum += (phases[k] >> 8) * sawScale;
+                }
+            }
+            float amp = sum * copyScale;
+            block[n] += addEffects(amp, volume, i);
+            if (horn) block[n] += calcHornVout(amp, volume, i);
+        }
+    }
+
+    const float noteScale = 1.0f / held;
+    for (int n = 0; n < length; n++) block[n] *= noteScale;
+    return held;
+}
+
+#endif
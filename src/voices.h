@@ -0,0 +1,93 @@
+#ifndef VOICES_H
+#define VOICES_H
+
+#include "pin.h"
+
+// -------------------- Voice Pool --------------------
+// Synthesis engines that keep per-voice state (envelopes, delay lines, decode
+// state) share a fixed pool of MAX_VOICES slots instead of one per note. Note
+// on/off edges are detected once per block; a slot stays allocated after its
+// key is released until the engine calls voiceFree() at the end of the tail.
+const int MAX_VOICES = 8;
+
+struct VoiceSlot {
+    int note = -1;            // -1 = free
+    bool held = false;
+    uint32_t startBlock = 0;
+};
+
+struct {
+    VoiceSlot slots[MAX_VOICES];
+    int8_t noteSlot[96];
+    bool wasActive[96];
+    uint32_t blockCount = 0;
+} voicePool;
+
+void voicePoolReset() {
+    for (int v = 0; v < MAX_VOICES; v++) {
+        voicePool.slots[v].note = -1;
+        voicePool.slots[v].held = false;
+    }
+    memset(voicePool.noteSlot, -1, sizeof(voicePool.noteSlot));
+    memset(voicePool.wasActive, 0, sizeof(voicePool.wasActive));
+}
+
+void voiceFree(int slot) {
+    int note = voicePool.slots[slot].note;
+    if (note >= 0 && voicePool.noteSlot[note] == slot) voicePool.noteSlot[note] = -1;
+    voicePool.slots[slot].note = -1;
+    voicePool.slots[slot].held = false;
+}
+
+// Free slot first, then the oldest released voice, then the oldest held one
+int voiceAllocate(int note) {
+    int best = -1;
+    for (int v = 0; v < MAX_VOICES; v++) {
+        const VoiceSlot& slot = voicePool.slots[v];
+        if (slot.note < 0) { best = v; break; }
+        if (best < 0) { best = v; continue; }
+        const VoiceSlot& current = voicePool.slots[best];
+        if ((current.held && !slot.held) ||
+            (current.held == slot.held && slot.startBlock < current.startBlock)) {
+            best = v;
+        }
+    }
+    voiceFree(best);
+    voicePool.slots[best].note = note;
+    voicePool.slots[best].held = true;
+    voicePool.slots[best].startBlock = voicePool.blockCount;
+    voicePool.noteSlot[note] = best;
+    return best;
+}
+
+typedef void (*VoiceStartFn)(int slot, int note);
+typedef void (*VoiceReleaseFn)(int slot);
+
+// Called at block start by the active engine
+void voicePoolScan(VoiceStartFn onStart, VoiceReleaseFn onRelease) {
+    voicePool.blockCount++;
+    for (int i = 0; i < 96; ++i) {
+        bool isActive = __atomic_load_n(&notes.notes[i].active, __ATOMIC_RELAXED);
+        if (isActive == voicePool.wasActive[i]) continue;
+        voicePool.wasActive[i] = isActive;
+
+        if (isActive) {
+            onStart(voiceAllocate(i), i);
+        } else if (voicePool.noteSlot[i] >= 0) {
+            int slot = voicePool.noteSlot[i];
+            voicePool.slots[slot].held = false;
+            voicePool.noteSlot[i] = -1;
+            onRelease(slot);
+        }
+    }
+}
+
+int voicesSounding() {
+    int count = 0;
+    for (int v = 0; v < MAX_VOICES; v++) {
+        if (voicePool.slots[v].note >= 0) count++;
+    }
+    return count;
+}
+
+#endif
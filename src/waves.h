@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <pin.h>
 #include "effect.h"  // Include audio effect utilities
+#include "bend.h"
 
 #define SAMPLE_RATE 22000
 #define AMPLITUDE 0.5
@@ -10,15 +11,8 @@
 
 // -------------------- Global Parameters --------------------
 float dt = 1.0f / SAMPLE_RATE;
-float _prevCutoff = 500;
-float _rc = 1.0f / (2.0f * PI * 500);
-float _alpha = dt / (_rc + dt);
-
-float lfo_frequency = 5.0;
-float lfo_depth = 0.01;
-float LFOAcc = 0;
-float _prevLfoFreq = 20;
-float lfoPhaseStep = 20 * 2 * PI / SAMPLE_RATE;
+SmoothedParam lpfAlpha;
+bool lpfOn = false;
 
 float attack_time = 0.1;
 float decay_time = 0.2;
@@ -57,16 +51,8 @@ float getSample(float phaseIncr, float* phaseAcc, float table[]) {
     return table[index];
 }
 
-float generateLFO(int reduceVal, float lfoFreq) {
-    if (lfoFreq != _prevLfoFreq) {
-        lfoPhaseStep = lfoFreq * 2 * PI / SAMPLE_RATE;
-        _prevLfoFreq = lfoFreq;
-    }
-    return getSample(lfoPhaseStep, &LFOAcc, sineTable) / reduceVal;
-}
-
 float calcSawtoothAmp(float* phaseAcc, int volume, int noteIndex) {
-    float step = notePhases[noteIndex];
+    float step = bentPhases[noteIndex];
     *phaseAcc += step;
     if (*phaseAcc > 1) *phaseAcc -= 1;
     return *phaseAcc;
@@ -78,14 +64,14 @@ int calcFade(int count, int sustainTime, int fadeSpeed) {
 }
 
 int adsrGeneral(int pressCount) {
-    int atk = __atomic_load_n(&settings.adsr.attack, __ATOMIC_RELAXED);
-    int dec = __atomic_load_n(&settings.adsr.decay, __ATOMIC_RELAXED) + atk;
-    int sus = __atomic_load_n(&settings.adsr.sustain, __ATOMIC_RELAXED) + dec;
+    int atk = backendSettings.adsr.attack;
+    int dec = backendSettings.adsr.decay + atk;
+    int sus = backendSettings.adsr.sustain + dec;
     if (pressCount < atk && pressCount > 0) return pressCount - atk / 2;
     else if (pressCount >= atk && pressCount <= dec) return pressCount - atk;
     else if (pressCount > dec && pressCount < sus) return dec - atk;
     else {
-        int fade = __atomic_load_n(&settings.adsr.sustain, __ATOMIC_RELAXED) + dec;
+        int fade = backendSettings.adsr.sustain + dec;
         return (dec - atk) + (pressCount - sus) / fade;
     }
 }
@@ -104,34 +90,49 @@ int adsrHorn(int pressCount) {
     }
 }
 
-float lowPassFilter(float current, float previous, float cutoffFreq) {
-    if (_prevCutoff != cutoffFreq) {
-        _rc = 1.0f / (2.0f * PI * cutoffFreq);
-        _alpha = dt / (_rc + dt);
-        _prevCutoff = cutoffFreq;
+float cutoffToAlpha(float cutoffFreq) {
+    float rc = 1.0f / (2.0f * PI * cutoffFreq);
+    return dt / (rc + dt);
+}
+
+// Called once per control block of `length` samples
+void updateLPFParams(int length) {
+    if (paramChanged(PARAM_LPF)) {
+        lpfOn = backendSettings.lowpass.on;
+        lpfAlpha.setTarget(cutoffToAlpha(backendSettings.lowpass.freq), length);
+    } else {
+        lpfAlpha.settle();
     }
-    return previous + _alpha * (current - previous);
+}
+
+// Cutoff modulation in octaves, once per block; overrides the ramp above while routed
+void modulateLPF(int length, float octaves) {
+    if (!lpfOn) return;
+    float freq = constrain(backendSettings.lowpass.freq * exp2f(octaves), 20.0f, SAMPLE_RATE * 0.45f);
+    lpfAlpha.setTarget(cutoffToAlpha(freq), length);
 }
 
 // -------------------- Output Mapping --------------------
-u_int32_t calcVout(float amp, int volume, int vshift) {
-    uint32_t output = static_cast<uint32_t>(amp * 255) - 128;
+// Amplitudes stay in float (8-bit full scale) until the output requantizer;
+// negative half-waves clip to zero as the old unsigned cast did on the M4.
+float calcVout(float amp, int volume, int vshift) {
+    float output = (amp > 0.0f) ? amp * 255 : 0.0f;
     int shift = 8 - volume + vshift;
-    return (shift >= 0) ? ((output + 128) >> shift) : ((output + 128) << -shift);
+    return ldexpf(output, -shift);
 }
 
-u_int32_t calcHornVout(float amp, int volume, int idx) {
-    uint32_t vout = static_cast<uint32_t>(amp * 127) - 128;
+float calcHornVout(float amp, int volume, int idx) {
+    float vout = (amp > 0.0f) ? amp * 127 : 0.0f;
     int shift = adsrHorn(notes.notes[idx].pressedCount);
     int volShift = 8 - volume + shift;
-    return (volShift >= 0) ? ((vout + 128) >> volShift) : ((vout + 128) << -volShift);
+    return ldexpf(vout, -volShift);
 }
 
 // -------------------- Audio Effects Chain --------------------
-u_int32_t addEffects(float amp, int volume, int idx) {
+float addEffects(float amp, int volume, int idx) {
     int shiftVal = 0;
     // bool fadeEnabled = __atomic_load_n(&settings.fade.on, __ATOMIC_RELAXED);
-    bool adsrEnabled = __atomic_load_n(&settings.adsr.on, __ATOMIC_RELAXED);
+    bool adsrEnabled = backendSettings.adsr.on;
 
     // if (fadeEnabled)
     //     shiftVal = calcFade(notes.notes[idx].pressedCount, settings.fade.sustainTime, settings.fade.fadeSpeed);
@@ -141,23 +142,14 @@ u_int32_t addEffects(float amp, int volume, int idx) {
     return calcVout(amp, volume, shiftVal);
 }
 
-// u_int32_t addLFO(float amp, int volume) {
-//     if (__atomic_load_n(&settings.lfo.on, __ATOMIC_RELAXED)) {
-//         int lfoVol = __atomic_load_n(&settings.lfo.reduceLFOVolume, __ATOMIC_RELAXED);
-//         int lfoFreq = __atomic_load_n(&settings.lfo.freq, __ATOMIC_RELAXED);
-//         amp = generateLFO(lfoVol, lfoFreq);
-//         return calcVout(amp, volume, 0);
-//     }
-//     return 0;
-// }
-
-float addLPF(float amp, float* prevAmp) {
-    if (__atomic_load_n(&settings.lowpass.on, __ATOMIC_RELAXED)) {
-        int cutoff = __atomic_load_n(&settings.lowpass.freq, __ATOMIC_RELAXED);
-        amp = lowPassFilter(amp, *prevAmp, cutoff);
-        *prevAmp = amp;
+void addLPF(float* block, int length, float* prevAmp) {
+    if (!lpfOn) return;
+    float previous = *prevAmp;
+    for (int n = 0; n < length; n++) {
+        previous += lpfAlpha.next() * (block[n] - previous);
+        block[n] = previous;
     }
-    return amp;
+    *prevAmp = previous;
 }
 
 // -------------------- Time Counter --------------------
@@ -2,6 +2,7 @@
 #include <STM32FreeRTOS.h>
 #include <ES_CAN.h>
 #include <cmath>
+#include <bitset>
 
 #include "input_read.h"
 #include "pin.h"
@@ -9,6 +10,17 @@
 #include "ui.h"
 #include "test.h"
 #include "effect.h"
+#include "output.h"
+#include "eq.h"
+#include "fm.h"
+#include "pluck.h"
+#include "sampler.h"
+#include "unison.h"
+#include "drums.h"
+#include "joystick.h"
+#include "noteevents.h"
+#include "uisnapshot.h"
+#include "log.h"
 
 // -------------------- Module: Sample Buffer Writer --------------------
 // Write output sample into active sample buffer
@@ -82,9 +94,9 @@ int auto_detect_init() {
     uint8_t detext_TX_Message[8] = {0};   // Message to send via CAN
     uint32_t detect_CAN_ID = 0x123;       // Common CAN ID for detection
 
-    std::bitset<28> inputs;
-    std::bitset<1> WestDetect;
-    std::bitset<1> EastDetect;
+    uint32_t inputs;
+    bool WestDetect;
+    bool EastDetect;
 
     // Display detection screen
     u8g2.clearBuffer();
@@ -101,12 +113,12 @@ int auto_detect_init() {
 
     // Read handshake detection pins
     inputs = readInputs();
-    WestDetect = extractBits<28, 1>(inputs, 23, 1);
-    EastDetect = extractBits<28, 1>(inputs, 27, 1);
+    WestDetect = INPUT_WEST_DETECT(inputs);
+    EastDetect = INPUT_EAST_DETECT(inputs);
     delay(2000);  // Allow time for signal propagation
 
     // If no board on the west → not the main board
-    if (!WestDetect[0]) {
+    if (!WestDetect) {
         Serial.println("West board detected (not main)");
 
         // Wait for confirmation message from main board
@@ -129,9 +141,9 @@ int auto_detect_init() {
         // Wait for handshake signal to be updated again
         do {
             inputs = readInputs();
-            WestDetect = extractBits<28, 1>(inputs, 23, 1);
+            WestDetect = INPUT_WEST_DETECT(inputs);
             delay(10);
-        } while (WestDetect[0]);
+        } while (WestDetect);
 
         Serial.println("Updated West Detect confirmed.");
         delay(200);
@@ -196,14 +208,7 @@ void scanKeysTask(void *pvParameters) {
     const TickType_t scanInterval = 20 / portTICK_PERIOD_MS;
     TickType_t lastWakeTime = xTaskGetTickCount();
 
-    std::bitset<12> currentKeys;
-    std::bitset<12> previousKeys("111111111111");
-
-    std::bitset<8> knobStatesCurrent, knobStatesPrevious("00000000");
-    std::bitset<4> knobClicksCurrent, knobClicksPrevious("0000");
-
-    std::bitset<1> joystickStateCurrent("0"), joystickStatePrevious("0");
-    std::bitset<1> westDetectPrevious, eastDetectPrevious;
+    uint32_t previousInputs = INPUT_KEYS.mask();
 
     int tunePrevious = 0;
     int tuneCurrent = 0;
@@ -214,36 +219,31 @@ void scanKeysTask(void *pvParameters) {
 
         // Lock shared state
         xSemaphoreTake(sysState.mutex, portMAX_DELAY);
-        xSemaphoreTake(notes.mutex, portMAX_DELAY);
         xSemaphoreTake(settings.mutex, portMAX_DELAY);
 
         // Read all hardware inputs
-        sysState.inputs = readInputs();
-
-        currentKeys = extractBits<inputSize, 12>(sysState.inputs, 0, 12);
-        sysState.WestDetect = extractBits<28, 1>(sysState.inputs, 23, 1);
-        sysState.EastDetect = extractBits<28, 1>(sysState.inputs, 27, 1);
-
-        knobStatesCurrent = extractBits<inputSize, 8>(sysState.inputs, 12, 8);
-        knobClicksCurrent = extractBits<inputSize, 4>(sysState.inputs, 20, 2).to_ulong() << 2 |
-                             extractBits<inputSize, 4>(sysState.inputs, 24, 2).to_ulong();
+        uint32_t inputs = readInputs();
+        uint32_t changed = inputs ^ previousInputs;
+        sysState.inputs = inputs;
 
-        joystickStateCurrent = extractBits<inputSize, 1>(sysState.inputs, 22, 1).to_ulong();
+        uint32_t currentKeys = INPUT_KEYS(inputs);
+        sysState.WestDetect = INPUT_WEST_DETECT(inputs);
+        sysState.EastDetect = INPUT_EAST_DETECT(inputs);
 
         // Toggle joystick flag if state changed and pressed
-        if (joystickStateCurrent != joystickStatePrevious && joystickStateCurrent == 0) {
+        if ((changed & INPUT_JOYSTICK_PRESS.mask()) && !INPUT_JOYSTICK_PRESS(inputs)) {
             sysState.joystickState = !sysState.joystickState;
         }
 
         // Update knob values and click states
-        updateKnob(sysState.knobValues, knobStatesPrevious, knobStatesCurrent,
-                   knobClicksPrevious, knobClicksCurrent);
+        quadratureScan(inputs, millis());
+        updateKnob(sysState.knobValues, previousInputs, inputs);
 
         // Update menu configuration
-        update_menu_settings(sysState.currentMenu, tuneCurrent);
+        update_menu_settings((MenuPage)__atomic_load_n(&sysState.currentMenu, __ATOMIC_RELAXED), tuneCurrent);
 
         // Sync tune if changed and in main board
-        if (tuneCurrent != tunePrevious && sysState.posId == 0 && !sysState.EastDetect[0]) {
+        if (tuneCurrent != tunePrevious && sysState.posId == 0 && !sysState.EastDetect) {
             Serial.println("Tune updated by main board.");
             __atomic_store_n(&settings.tune, tuneCurrent, __ATOMIC_RELAXED);
             TX_Message[0] = 'T';
@@ -252,7 +252,7 @@ void scanKeysTask(void *pvParameters) {
         }
 
         // Trigger position update if WestDetect changes
-        if (eastDetectPrevious[0] && westDetectPrevious[0] && (!sysState.WestDetect[0])) {
+        if (INPUT_EAST_DETECT(previousInputs) && INPUT_WEST_DETECT(previousInputs) && !sysState.WestDetect) {
             Serial.println("Triggering position update request...");
             delay(100);
             TX_Message[0] = 'N';
@@ -261,42 +261,38 @@ void scanKeysTask(void *pvParameters) {
         }
 
         // Main board operation: local sound play
-        if (sysState.WestDetect[0] && sysState.EastDetect[0]) {
+        if (sysState.WestDetect && sysState.EastDetect) {
             sysState.posId = 0;
             int tune = __atomic_load_n(&settings.tune, __ATOMIC_RELAXED);
-            for (int i = 0; i < 12; ++i) {
-                if (currentKeys.to_ulong() != 0xFFF) {
-                    notes.notes[(tune - 1) * 12 + i].active = !currentKeys[i];
-                } else {
-                    notes.notes[(tune - 1) * 12 + i].active = false;
-                }
+            uint32_t keysChanged = INPUT_KEYS(changed);
+            while (keysChanged) {
+                int i = __builtin_ctz(keysChanged);
+                keysChanged &= keysChanged - 1;
+                noteEventPost((currentKeys >> i & 1) ? NOTE_EVENT_OFF : NOTE_EVENT_ON, (tune - 1) * 12 + i, 0);
             }
         }
         // Relay mode: forward note state changes via CAN
         else {
-            for (int i = 0; i < 12; ++i) {
-                if (currentKeys[i] != previousKeys[i]) {
-                    TX_Message[0] = currentKeys[i] ? 'R' : 'P';
-                    TX_Message[1] = i;
-                    TX_Message[2] = settings.tune;
-                    TX_Message[3] = sysState.posId;
-                    xQueueSend(msgOutQ, const_cast<uint8_t *>(TX_Message), portMAX_DELAY);
-                }
+            uint32_t keysChanged = INPUT_KEYS(changed);
+            while (keysChanged) {
+                int i = __builtin_ctz(keysChanged);
+                keysChanged &= keysChanged - 1;
+                TX_Message[0] = (currentKeys >> i & 1) ? 'R' : 'P';
+                TX_Message[1] = i;
+                TX_Message[2] = settings.tune;
+                TX_Message[3] = sysState.posId;
+                xQueueSend(msgOutQ, const_cast<uint8_t *>(TX_Message), portMAX_DELAY);
             }
         }
 
         // Store previous values for next loop
         tunePrevious = tuneCurrent;
-        previousKeys = currentKeys;
-        knobStatesPrevious = knobStatesCurrent;
-        knobClicksPrevious = knobClicksCurrent;
-        joystickStatePrevious = joystickStateCurrent;
-        westDetectPrevious = sysState.WestDetect;
-        eastDetectPrevious = sysState.EastDetect;
+        previousInputs = inputs;
 
         // Release all mutexes
+        settingsPublish();
+        uiPublish();
         xSemaphoreGive(sysState.mutex);
-        xSemaphoreGive(notes.mutex);
         xSemaphoreGive(settings.mutex);
         Serial.println(micros() - startTime);
     }
@@ -304,56 +300,13 @@ void scanKeysTask(void *pvParameters) {
 
 // -------------------- Task: Joystick Scanning --------------------
 void scanJoystickTask(void *pvParameters) {
-    const TickType_t xFrequency = 100 / portTICK_PERIOD_MS;
+    const TickType_t xFrequency = 5 / portTICK_PERIOD_MS;
+    joystickCalibrate();
     TickType_t xLastWakeTime = xTaskGetTickCount();
 
-    const int origin = 490;    // Joystick center position
-    const int deadZone = 150;  // Threshold to ignore small fluctuations
-    int joystickX = 0, joystickY = 0;
-
-    std::string previousMovement = "origin";
-    std::string currentMovement;
-
     while (1) {
         vTaskDelayUntil(&xLastWakeTime, xFrequency);
-
-        joystickX = analogRead(JOYX_PIN);
-        joystickY = analogRead(JOYY_PIN);
-
-        // Determine joystick movement direction
-        if (abs(joystickX - origin) <= deadZone && abs(joystickY - origin) <= deadZone) {
-            currentMovement = "origin";
-        } else if (joystickX - origin > deadZone) {
-            currentMovement = "left";
-        } else if (joystickX - origin < -deadZone) {
-            currentMovement = "right";
-        } else if (joystickY - origin > deadZone) {
-            currentMovement = "down";
-            // Scroll menu down
-            if (selected_option < total_menu_items - 1) {
-                selected_option++;
-                if ((selected_option * ITEM_SPACING) >= (menu_offset + PAGE_HEIGHT)) {
-                    menu_offset += ITEM_SPACING;
-                }
-            }
-        } else if (joystickY - origin < -deadZone) {
-            currentMovement = "up";
-            // Scroll menu up
-            if (selected_option > 0) {
-                selected_option--;
-                if ((selected_option * ITEM_SPACING) < menu_offset) {
-                    menu_offset = std::max(0, menu_offset - ITEM_SPACING);
-                }
-            }
-        }
-
-        // Confirm movement only when joystick returns to center
-        if (currentMovement != previousMovement && currentMovement == "origin") {
-            movement = previousMovement;
-        } else {
-            movement = "origin";
-        }
-        previousMovement = currentMovement;
+        joystickPoll();
     }
 }
 
@@ -369,15 +322,15 @@ void displayUpdateTask(void * pvParameters) {
     int stay_time = 2000;
     int counter = 0;
     int pressedKeyH = 20;
-    std::bitset<2> previous_knob1("00");
-    std::bitset<2> previous_knob2("00");
-    std::bitset<2> previous_knob3("00");
+    const uint32_t valueKnobs = inputKnob(1).mask() | inputKnob(2).mask() | inputKnob(3).mask();
+    uint32_t previousInputs = 0;
     
     while (1) {
         vTaskDelayUntil(&xLastWakeTime2, xFrequency2);
+        const UiSnapshot& ui = uiTake();
         u8g2.clearBuffer();
 
-        if (sysState.posId != 0) {
+        if (ui.posId != 0) {
             u8g2.setCursor(30, 15);
             u8g2.setFont(u8g2_font_ncenB08_tr);
             u8g2.print("Slave board");
@@ -387,109 +340,69 @@ void displayUpdateTask(void * pvParameters) {
             if (counter != 0) {
                 counter--;
             }
-            xSemaphoreTake(sysState.mutex, portMAX_DELAY);
-            xSemaphoreTake(settings.mutex, portMAX_DELAY);
-
-            if (sysState.knobValues[0].clickState) {
+            if (ui.menuOpen) {
                 u8g2.setFont(u8g2_font_6x10_tr);
-                if (movement == "down") {
-                    index += 3;
-                } else if (movement == "up") {
-                    index -= 3;
-                } else if (movement == "right") {
-                    index += 1;
-                } else if (movement == "left") {
-                    index -= 1;
-                }
-                index = constrain(index, 0, 6);
-
-                if ((index * ITEM_SPACING) >= (menu_offset + PAGE_HEIGHT)) {
-                    menu_offset += ITEM_SPACING;
-                } else if ((index * ITEM_SPACING) < menu_offset) {
-                    menu_offset -= ITEM_SPACING;
+                switch (joystickTakeGesture()) {
+                    case JOY_DOWN:  index += 3; break;
+                    case JOY_UP:    index -= 3; break;
+                    case JOY_RIGHT: index += 1; break;
+                    case JOY_LEFT:  index -= 1; break;
+                    default: break;
                 }
+                index = constrain(index, 0, total_menu_items - 1);
+                menu_offset = menuScroll(menu_offset, index);
 
                 // Draw menu items in rows
-                for (int i = 0; i < 7; i++) {
-                    int x_pos, y_pos;
-                    if (i < 3) {            // First row
-                        x_pos = 10 + 35 * i;
-                        y_pos = 14;
-                    } else if (i < 6) {     // Second row
-                        x_pos = 10 + 35 * (i - 3);
-                        y_pos = 25;
-                    } else {                // Third row (single "Effect" option)
-                        x_pos = 10 + 35;  // Center the "Effect" option
-                        y_pos = 36;
-                    }
-
-                    // Slow slide effect for last item when selected
-                    if (index == 6) {
-                        if (menu_offset < ITEM_SPACING * 2) {
-                            menu_offset += 2;
-                        }
-                    } else if (index != 6) {
-                        menu_offset = 0;
-                    }
-
-                    int final_y_pos = y_pos - menu_offset;
+                for (int i = 0; i < total_menu_items; i++) {
+                    int x_pos = 10 + 35 * (i % MENU_COLUMNS);
+                    int final_y_pos = menuItemY(i, menu_offset);
                     // Draw only if within visible area
-                    if (final_y_pos >= 10 && final_y_pos < PAGE_HEIGHT + 10) {
+                    if (menuItemVisible(final_y_pos)) {
                         u8g2.setCursor(x_pos, final_y_pos);
-                        u8g2.print(menu_first_level[i].c_str());
+                        u8g2.print(menuPages[menuItemPage(i)].label);
                         // Highlight selected menu item
                         if (index == i) {
                             u8g2.drawFrame(x_pos - 3, final_y_pos - 9, 32, 12);
                         }
                     }
                 }
-                if (sysState.joystickState) {
-                    menu(index, settings);
+                __atomic_store_n(&sysState.currentMenu, ui.pageOpen ? menuItemPage(index) : PAGE_GRID, __ATOMIC_RELAXED);
+                if (ui.pageOpen) {
+                    menu(menuItemPage(index), ui.values);
                 }
             } else {
-                sysState.currentMenu = "Main";
+                __atomic_store_n(&sysState.currentMenu, PAGE_HOME, __ATOMIC_RELAXED);
                 u8g2.setCursor(15, 10);
                 u8g2.setFont(u8g2_font_ncenB08_tr);
                 u8g2.print("LUGUAN Keyboard");
                 u8g2.setFont(u8g2_font_5x8_tr);
                 for (int i = 0; i < 4; i++) {
                     u8g2.drawFrame(8 + 30 * i, 20, 25, 20);
-                    if (i != 0 && 
-                        (extractBits<inputSize, 2>(sysState.inputs, 12, 2) != previous_knob3 ||
-                         extractBits<inputSize, 2>(sysState.inputs, 14, 2) != previous_knob2 ||
-                         extractBits<inputSize, 2>(sysState.inputs, 16, 2) != previous_knob1)) {
+                    if (i != 0 && ((ui.inputs ^ previousInputs) & valueKnobs)) {
                         counter = stay_time / 100;
                     }
                     if (counter != 0 && i == 3) {
-                        u8g2.drawStr(10 + 30 * i, 29, std::to_string(settings.volume).c_str());
+                        drawNumber(10 + 30 * i, 29, ui.values.volume);
                     } else if (counter != 0 && i == 2) {
-                        u8g2.drawStr(10 + 30 * i, 29, std::to_string(settings.tune).c_str());
+                        drawNumber(10 + 30 * i, 29, ui.values.tune);
                     } else if (counter != 0 && i == 1) {
-                        u8g2.drawStr(10 + 30 * i, 29, waveNames[settings.waveIndex].c_str());
+                        u8g2.drawStr(10 + 30 * i, 29, waveNames[ui.values.waveIndex]);
                     } else {
-                        u8g2.drawStr(10 + 30 * i, 29, bottomBar_menu[i].c_str());
+                        u8g2.drawStr(10 + 30 * i, 29, bottomBar_menu[i]);
                     }
                 }
             }
-            previous_knob1 = extractBits<inputSize, 2>(sysState.inputs, 16, 2);
-            previous_knob2 = extractBits<inputSize, 2>(sysState.inputs, 14, 2);
-            previous_knob3 = extractBits<inputSize, 2>(sysState.inputs, 12, 2);
-            xSemaphoreGive(sysState.mutex);
-            xSemaphoreGive(settings.mutex);
+            previousInputs = ui.inputs;
         }
 
         u8g2.setFont(u8g2_font_5x8_tr);
         // Display pressed keys
-        std::vector<std::string> pressedKeys;
+        int pressedCount = 0;
         for (int i = 0; i < 12; i++) {
-            if (sysState.inputs[i] == 0) {
-                pressedKeys.push_back(noteNames[i]);
+            if (!(ui.inputs >> i & 1)) {
+                u8g2.drawStr(10 + 10 * pressedCount++, pressedKeyH, noteNames[i]);
             }
         }
-        for (int i = 0; i < pressedKeys.size(); i++) {
-            u8g2.setCursor(10 + 10 * i, pressedKeyH);
-            u8g2.print(pressedKeys[i].c_str());
-        }
 
         u8g2.sendBuffer();
         digitalToggle(LED_BUILTIN);
@@ -506,10 +419,12 @@ void backgroundCalcTask(void *pvParameters) {
         // Wait for buffer availability
         xSemaphoreTake(sampleBufferSemaphore, portMAX_DELAY);
         uint32_t writeCtr = 0;
+        settingsSnapshot();
 
         while (writeCtr < SAMPLE_BUFFER_SIZE / 2) {
-            int vol_knob_value = settings.volume;
-            int version_knob_value = 8 - settings.waveIndex;
+            noteEventsDrain();
+            int vol_knob_value = backendSettings.volume;
+            int version_knob_value = 8 - backendSettings.waveIndex;
 
             bool hasActiveKey = false;
             int activeKeyCount = 0;
@@ -559,7 +474,6 @@ void backgroundCalcTask(void *pvParameters) {
 
                     // Effect Chain
                     floatAmp += addEffects(amp, vol_knob_value, i);
-                    floatAmp = applyEffects(floatAmp);
                 }
 
                 // When reaching the last note, finalize this sample
@@ -591,17 +505,16 @@ void decodeTask(void * pvParameters) {
         xQueueReceive(msgInQ, RX_Message, portMAX_DELAY);
 
         xSemaphoreTake(sysState.mutex, portMAX_DELAY);
-        xSemaphoreTake(notes.mutex, portMAX_DELAY);
         xSemaphoreTake(settings.mutex, portMAX_DELAY);
 
         // Handle Note Press/Release for Main Board
         if (sysState.posId == 0) {
             if (RX_Message[0] == 'P') {
-                sysState.inputs[RX_Message[1]] = 0;
-                notes.notes[(RX_Message[2] - 1) * 12 + RX_Message[1]].active = true;
+                sysState.inputs &= ~(1u << RX_Message[1]);
+                noteEventPost(NOTE_EVENT_ON, (RX_Message[2] - 1) * 12 + RX_Message[1], RX_Message[3]);
             } else if (RX_Message[0] == 'R') {
-                sysState.inputs[RX_Message[1]] = 1;
-                notes.notes[(RX_Message[2] - 1) * 12 + RX_Message[1]].active = false;
+                sysState.inputs |= 1u << RX_Message[1];
+                noteEventPost(NOTE_EVENT_OFF, (RX_Message[2] - 1) * 12 + RX_Message[1], RX_Message[3]);
             }
         }
         // Forward Message from Board 0 to Board 1
@@ -638,7 +551,8 @@ void decodeTask(void * pvParameters) {
             }
         }
 
-        xSemaphoreGive(notes.mutex);
+        settingsPublish();
+        uiPublish();
         xSemaphoreGive(sysState.mutex);
         xSemaphoreGive(settings.mutex);
         Serial.println(micros() - startTime);
@@ -698,48 +612,7 @@ void displayTime() {
 
 // -------------------- Function: Run Joystick Task Once --------------------
 void runJoystickTaskOnce() {
-    const int origin = 490;    // Joystick center position
-    const int deadZone = 150;  // Ignore small fluctuations
-    int joystickX = analogRead(JOYX_PIN);
-    int joystickY = analogRead(JOYY_PIN);
-
-    std::string currentMovement = "origin";
-
-    // Determine joystick movement direction
-    if (abs(joystickX - origin) <= deadZone && abs(joystickY - origin) <= deadZone) {
-        currentMovement = "origin";
-    } else if (joystickX - origin > deadZone) {
-        currentMovement = "left";
-    } else if (joystickX - origin < -deadZone) {
-        currentMovement = "right";
-    } else if (joystickY - origin > deadZone) {
-        currentMovement = "down";
-        // Scroll menu down
-        if (selected_option < total_menu_items - 1) {
-            selected_option++;
-            if ((selected_option * ITEM_SPACING) >= (menu_offset + PAGE_HEIGHT)) {
-                menu_offset += ITEM_SPACING;
-            }
-        }
-    } else if (joystickY - origin < -deadZone) {
-        currentMovement = "up";
-        // Scroll menu up
-        if (selected_option > 0) {
-            selected_option--;
-            if ((selected_option * ITEM_SPACING) < menu_offset) {
-                menu_offset = std::max(0, menu_offset - ITEM_SPACING);
-            }
-        }
-    }
-
-    // Confirm movement only when joystick returns to center
-    static std::string previousMovement = "origin";
-    if (currentMovement != previousMovement && currentMovement == "origin") {
-        movement = previousMovement;
-    } else {
-        movement = "origin";
-    }
-    previousMovement = currentMovement;
+    joystickPoll();
 }
 
 void joystickTime() {
@@ -781,6 +654,718 @@ void decodeTime() {
     }
 }
 
+// -------------------- Helper: Publish Test Settings --------------------
+// Tests edit settings directly; hand them to the backend as the tasks do
+void publishSettings() {
+    settingsPublish();
+    settingsSnapshot();
+}
+
+// -------------------- Function: Check Delay Echo Timing --------------------
+// Feeds an impulse into the delay and reports the first echo position in samples
+void delayEchoTest() {
+    initEffects();
+    initDelayBuffer();
+    settings.delay_on = true;
+    settings.delay_strength = 5;
+    settings.delay_division = 4;
+
+    Serial.print("[Delay] Decimation: ");
+    Serial.println(delayDecimation);
+
+    for (int speed = 1; speed <= 7; speed++) {
+        settings.metronome.speed = speed;
+        resetDelay();
+        touchParam(PARAM_DELAY);
+        publishSettings();
+        updateEffectParams(1);
+        delayFeedback.settle();
+        delayWet.target = 1.0f;  // Echo only
+        delayWet.settle();
+
+        int expected = delayTimeSamples(speed, settings.delay_division);
+        int measured = -1;
+        for (int n = 0; n <= expected + 2 * delayDecimation; n++) {
+            float out = (n == 0) ? 100.0f : 0.0f;
+            delayBlock(&out, 1);
+            if (n > 0 && out > 0.5f) {
+                measured = n;
+                break;
+            }
+        }
+
+        Serial.print("[Delay] Speed ");
+        Serial.print(speed);
+        Serial.print(" expected: ");
+        Serial.print(expected);
+        Serial.print(" measured: ");
+        Serial.print(measured);
+        Serial.println((measured >= expected && measured < expected + delayDecimation + 1) ? " PASS" : " FAIL");
+    }
+    settings.delay_on = false;
+    publishSettings();
+}
+
+// -------------------- Function: Settings Snapshot Test --------------------
+// The backend copy only changes on a publish, and both ends stay cheap
+void settingsSnapshotTest() {
+    int volume = settings.volume;
+    settings.volume = 3;
+    publishSettings();
+    settings.volume = 7;
+    settingsSnapshot();
+    bool isolated = backendSettings.volume == 3;
+    settingsPublish();
+    settingsSnapshot();
+    Serial.print("[Settings] snapshot: ");
+    Serial.println((isolated && backendSettings.volume == 7) ? "PASS" : "FAIL");
+
+    // A publish in progress: the backend keeps its previous copy whole
+    settingsSeqlock.sequence++;
+    settingsSeqlock.snapshot.values.volume = 1;
+    bool taken = settingsSnapshot();
+    settingsSeqlock.sequence++;
+    Serial.print("[Settings] publish in progress keeps previous: ");
+    Serial.println((!taken && backendSettings.volume == 7) ? "PASS" : "FAIL");
+
+    const int iterations = 100;
+    uint32_t startTime = micros();
+    for (int i = 0; i < iterations; i++) settingsPublish();
+    uint32_t publishTime = micros() - startTime;
+    startTime = micros();
+    for (int i = 0; i < iterations; i++) settingsSnapshot();
+    uint32_t snapshotTime = micros() - startTime;
+    Serial.print("[Settings] bytes: ");
+    Serial.print(sizeof(SettingsSnapshot));
+    Serial.print(" publish: ");
+    Serial.print((float)publishTime / iterations);
+    Serial.print(" us, snapshot: ");
+    Serial.print((float)snapshotTime / iterations);
+    Serial.print(" us, torn copies retried: ");
+    Serial.println(settingsSnapshotRetries);
+
+    settings.volume = volume;
+    publishSettings();
+}
+
+// -------------------- Function: Menu Grid Scroll Test --------------------
+// Walks the selection over every grid item, down and back up and then by
+// whole rows as the joystick does, and checks the selected label is on screen
+void menuScrollTest() {
+    int offset = 0;
+    int hidden = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        for (int step = 0; step < total_menu_items; step++) {
+            int index = pass ? total_menu_items - 1 - step : step;
+            offset = menuScroll(offset, index);
+            if (!menuItemVisible(menuItemY(index, offset)) || offset % MENU_ROW_SPACING) hidden++;
+        }
+    }
+    for (int column = 0; column < MENU_COLUMNS; column++) {
+        for (int index = column; index < total_menu_items; index += MENU_COLUMNS) {
+            offset = menuScroll(offset, index);
+            if (!menuItemVisible(menuItemY(index, offset))) hidden++;
+        }
+    }
+
+    Serial.print("[Menu] Items: ");
+    Serial.print(total_menu_items);
+    Serial.print(" selections off screen: ");
+    Serial.print(hidden);
+    Serial.println(hidden == 0 ? " PASS" : " FAIL");
+}
+
+// -------------------- Function: UI Snapshot Test --------------------
+// The display sees the latest complete publish, keeps it until the next one,
+// and a publish costs one settings copy
+void uiSnapshotTest() {
+    int volume = settings.volume;
+    settings.volume = 2;
+    uiPublish();
+    settings.volume = 5;
+    uiPublish();
+    bool latest = uiTake().values.volume == 5;
+    bool kept = uiTake().values.volume == 5;
+    settings.volume = 6;
+    uiPublish();
+    bool next = uiTake().values.volume == 6;
+    Serial.print("[UI] snapshot: ");
+    Serial.println((latest && kept && next) ? "PASS" : "FAIL");
+
+    const int iterations = 100;
+    uint32_t startTime = micros();
+    for (int i = 0; i < iterations; i++) uiPublish();
+    Serial.print("[UI] bytes: ");
+    Serial.print(sizeof(UiSnapshot));
+    Serial.print(" publish: ");
+    Serial.print((float)(micros() - startTime) / iterations);
+    Serial.println(" us");
+
+    settings.volume = volume;
+    uiPublish();
+}
+
+// -------------------- Function: Measure Output Requantizer SNR and Cost --------------------
+// A quiet 1 kHz sine (3 LSB at 8-bit) through each noise shaping order. The
+// in-band figure weights the error with a 4 kHz one-pole lowpass.
+// tools/outputbench.cpp runs the same measurement on a host.
+void outputSNRTest() {
+    const int N = SAMPLE_BUFFER_SIZE / 2;
+    const float amplitude = 3.0f;
+    static float input[N];
+    for (int n = 0; n < N; n++) {
+        input[n] = 128.0f + amplitude * sinf(2 * PI * 1000.0f * n / SAMPLE_RATE);
+    }
+    float alpha = cutoffToAlpha(4000.0f);
+    float signalPower = amplitude * amplitude / 2;
+
+    for (int order = 0; order <= 2; order++) {
+        outputShaper.order = order;
+        resetOutputShaper();
+
+        uint32_t startTime = micros();
+        for (int n = 0; n < N; n++) {
+            sampleBuffer0[n] = requantize(input[n]);
+        }
+        uint32_t elapsed = micros() - startTime;
+
+        float noisePower = 0.0f, inbandPower = 0.0f, lp = 0.0f;
+        for (int n = 0; n < N; n++) {
+            float e = sampleBuffer0[n] / OUTPUT_SCALE - input[n];
+            lp += alpha * (e - lp);
+            noisePower += e * e;
+            inbandPower += lp * lp;
+        }
+
+        Serial.print("[Output] Order ");
+        Serial.print(order);
+        Serial.print(" SNR (dB): ");
+        Serial.print(10 * log10f(signalPower / (noisePower / N)));
+        Serial.print(" in-band SNR (dB): ");
+        Serial.print(10 * log10f(signalPower / (inbandPower / N)));
+        Serial.print(" cycles/sample: ");
+        Serial.println(elapsed * (SystemCoreClock / 1000000) / N);
+    }
+    outputShaper.order = NOISE_SHAPING_ORDER;
+    resetOutputShaper();
+}
+
+// -------------------- Function: Measure Master EQ Cost --------------------
+// Cycles per sample for one biquad band, and for the full float <-> Q20
+// conversion plus 1..EQ_BANDS cascaded bands. tools/eqbench.cpp times the
+// same code on a host.
+void eqTime() {
+    const int N = SAMPLE_BUFFER_SIZE / 2;
+    static float block[N];
+    for (int n = 0; n < N; n++) {
+        block[n] = 128.0f + 100.0f * sinf(2 * PI * 440.0f * n / SAMPLE_RATE);
+    }
+    uint32_t cyclesPerMicro = SystemCoreClock / 1000000;
+
+    designBiquad(eqBiquads[0], eqShapes[0], 6.0f);
+    for (int n = 0; n < EQ_BLOCK_SIZE; n++) eqScratch[n] = (int32_t)(block[n] * (1u << EQ_SAMPLE_SHIFT));
+    uint32_t startTime = micros();
+    for (int i = 0; i < 100; i++) {
+        biquadBlock(eqBiquads[0], eqScratch, EQ_BLOCK_SIZE);
+    }
+    Serial.print("[EQ] Cycles/sample per band: ");
+    Serial.println((micros() - startTime) * cyclesPerMicro / (100 * EQ_BLOCK_SIZE));
+
+    settings.eq.on = true;
+    for (int bands = 1; bands <= EQ_BANDS; bands++) {
+        for (int i = 0; i < EQ_BANDS; i++) settings.eq.gain[i] = (i < bands) ? 2 : 0;
+        touchParam(PARAM_EQ);
+        publishSettings();
+        updateEQParams();
+
+        startTime = micros();
+        eqBlock(block, N);
+        Serial.print("[EQ] Bands: ");
+        Serial.print(bands);
+        Serial.print(" cycles/sample: ");
+        Serial.println((micros() - startTime) * cyclesPerMicro / N);
+    }
+    settings.eq.on = false;
+    touchParam(PARAM_EQ);
+    publishSettings();
+    updateEQParams();
+}
+
+// -------------------- Function: Measure FM Voice Cost and Polyphony --------------------
+// Renders one buffer with MAX_VOICES held notes per algorithm and reports how
+// many FM voices fit in the block deadline (SAMPLE_BUFFER_SIZE / 2 samples)
+void fmTime() {
+    const int N = SAMPLE_BUFFER_SIZE / 2;
+    static float block[EFFECT_BLOCK_SIZE];
+    uint32_t cyclesPerMicro = SystemCoreClock / 1000000;
+    uint32_t deadlineCycles = (uint32_t)((uint64_t)SystemCoreClock * N / SAMPLE_RATE);
+
+    fmInit();
+    for (int alg = 0; alg < FM_ALG_COUNT; alg++) {
+        settings.fm.algorithm = alg;
+        touchParam(PARAM_FM);
+        publishSettings();
+        voicePoolReset();
+        for (int i = 0; i < MAX_VOICES; i++) notes.notes[36 + i].active = true;
+
+        uint32_t startTime = micros();
+        for (int offset = 0; offset < N; offset += EFFECT_BLOCK_SIZE) {
+            fmRenderBlock(block, std::min(EFFECT_BLOCK_SIZE, N - offset), 6);
+        }
+        uint32_t cycles = (micros() - startTime) * cyclesPerMicro;
+        uint32_t perVoice = cycles / MAX_VOICES;
+
+        Serial.print("[FM] Algorithm ");
+        Serial.print(alg);
+        Serial.print(" cycles/voice/sample: ");
+        Serial.print(perVoice / N);
+        Serial.print(" max voices in deadline: ");
+        Serial.println(deadlineCycles / perVoice);
+
+        for (int i = 0; i < MAX_VOICES; i++) notes.notes[36 + i].active = false;
+    }
+}
+
+// -------------------- Function: Measure Plucked String Cost and Memory --------------------
+// Plucks MAX_VOICES strings across the keyboard and reports per-voice memory,
+// cycles per voice-sample and how many strings fit in the block deadline
+void pluckTime() {
+    const int N = SAMPLE_BUFFER_SIZE / 2;
+    static float block[EFFECT_BLOCK_SIZE];
+    uint32_t cyclesPerMicro = SystemCoreClock / 1000000;
+    uint32_t deadlineCycles = (uint32_t)((uint64_t)SystemCoreClock * N / SAMPLE_RATE);
+
+    voicePoolReset();
+    for (int i = 0; i < MAX_VOICES; i++) notes.notes[12 + 9 * i].active = true;
+
+    uint32_t startTime = micros();
+    for (int offset = 0; offset < N; offset += EFFECT_BLOCK_SIZE) {
+        pluckRenderBlock(block, std::min(EFFECT_BLOCK_SIZE, N - offset), 6);
+    }
+    uint32_t cycles = (micros() - startTime) * cyclesPerMicro;
+    uint32_t perVoice = cycles / MAX_VOICES;
+
+    Serial.print("[Pluck] Bytes per voice: ");
+    Serial.print(sizeof(PluckVoice) + sizeof(pluckDelayLines[0]));
+    Serial.print(" cycles/voice/sample: ");
+    Serial.print(perVoice / N);
+    Serial.print(" max voices in deadline: ");
+    Serial.println(deadlineCycles / perVoice);
+
+    for (int i = 0; i < MAX_VOICES; i++) notes.notes[12 + 9 * i].active = false;
+}
+
+// -------------------- Function: Measure ADPCM Sample Decode Cost --------------------
+// Plays MAX_VOICES notes from the sampler and reports decoder state per voice,
+// cycles per voice-sample and how many voices fit in the block deadline.
+// Higher keys step through more source samples per output sample.
+void samplerTime() {
+    const int N = SAMPLE_BUFFER_SIZE / 2;
+    const int firstKeys[] = {12, 30};
+    static float block[EFFECT_BLOCK_SIZE];
+    uint32_t cyclesPerMicro = SystemCoreClock / 1000000;
+    uint32_t deadlineCycles = (uint32_t)((uint64_t)SystemCoreClock * N / SAMPLE_RATE);
+
+    samplerInit();
+    for (int firstKey : firstKeys) {
+        voicePoolReset();
+        for (int i = 0; i < MAX_VOICES; i++) notes.notes[firstKey + i].active = true;
+
+        uint32_t startTime = micros();
+        for (int offset = 0; offset < N; offset += EFFECT_BLOCK_SIZE) {
+            samplerRenderBlock(block, std::min(EFFECT_BLOCK_SIZE, N - offset), 6);
+        }
+        uint32_t cycles = (micros() - startTime) * cyclesPerMicro;
+        uint32_t perVoice = cycles / MAX_VOICES;
+
+        Serial.print("[Sampler] Keys from ");
+        Serial.print(firstKey);
+        Serial.print(" bytes per voice: ");
+        Serial.print(sizeof(SamplerVoice));
+        Serial.print(" cycles/voice/sample: ");
+        Serial.print(perVoice / N);
+        Serial.print(" max voices in deadline: ");
+        Serial.println(deadlineCycles / perVoice);
+
+        for (int i = 0; i < MAX_VOICES; i++) notes.notes[firstKey + i].active = false;
+    }
+}
+
+// -------------------- Function: Measure Unison Oscillator Cost --------------------
+// Renders one buffer of a 6-note chord with 7 unison copies and reports the
+// cost per oscillator-sample, and how many oscillators fit in half of the
+// block deadline (the reference for UNISON_OSC_BUDGET)
+void unisonTime() {
+    const int N = SAMPLE_BUFFER_SIZE / 2;
+    const int chord = 6;
+    static float block[EFFECT_BLOCK_SIZE];
+    uint32_t cyclesPerMicro = SystemCoreClock / 1000000;
+    uint32_t deadlineCycles = (uint32_t)((uint64_t)SystemCoreClock * N / SAMPLE_RATE);
+
+    settings.unison.voices = UNISON_MAX;
+    touchParam(PARAM_UNISON);
+    publishSettings();
+    updateUnisonParams();
+    for (int i = 0; i < chord; i++) notes.notes[36 + 4 * i].active = true;
+
+    for (int wave = 0; wave < 2; wave++) {
+        const float* table = wave ? sineTable : nullptr;
+        uint32_t startTime = micros();
+        for (int offset = 0; offset < N; offset += EFFECT_BLOCK_SIZE) {
+            unisonRenderBlock(block, std::min(EFFECT_BLOCK_SIZE, N - offset), 6, table, false);
+        }
+        uint32_t cycles = (micros() - startTime) * cyclesPerMicro;
+        uint32_t perOsc = cycles / (chord * UNISON_MAX);
+
+        Serial.print(wave ? "[Unison] Table" : "[Unison] Saw");
+        Serial.print(" cycles/oscillator/sample: ");
+        Serial.print(perOsc / N);
+        Serial.print(" oscillators in half the deadline: ");
+        Serial.println(deadlineCycles / 2 / perOsc);
+    }
+
+    for (int i = 0; i < chord; i++) notes.notes[36 + 4 * i].active = false;
+}
+
+// -------------------- Function: Measure Drum Kit Cost --------------------
+// Renders one buffer with every pad sounding and reports the kit's share of
+// the block deadline. tools/drumbench.cpp times the pads on a host.
+void drumTime() {
+    const int N = SAMPLE_BUFFER_SIZE / 2;
+    static float block[EFFECT_BLOCK_SIZE];
+    uint32_t cyclesPerMicro = SystemCoreClock / 1000000;
+    uint32_t deadlineCycles = (uint32_t)((uint64_t)SystemCoreClock * N / SAMPLE_RATE);
+
+    drumsInit();
+    settings.drums.on = true;
+    settings.drums.pattern = 0;
+    publishSettings();
+    // Open hat last, or the closed hat chokes it
+    for (int p = 0; p < DRUM_PADS; p++) drumStart(p == DRUM_OPEN_HAT ? DRUM_CLOSED_HAT : p);
+    drumStart(DRUM_OPEN_HAT);
+
+    uint32_t startTime = micros();
+    for (int offset = 0; offset < N; offset += EFFECT_BLOCK_SIZE) {
+        addDrums(block, std::min(EFFECT_BLOCK_SIZE, N - offset), 6);
+    }
+    uint32_t cycles = (micros() - startTime) * cyclesPerMicro;
+
+    Serial.print("[Drums] Full kit cycles/sample: ");
+    Serial.print(cycles / N);
+    Serial.print(" share of deadline (%): ");
+    Serial.println(100.0f * cycles / deadlineCycles);
+
+    settings.drums.on = false;
+    publishSettings();
+}
+
+// -------------------- Function: Measure Additive Table Builds and Cache --------------------
+// Times one table build per octave (more partials fit in the lower ones),
+// then checks that the cache hits, evicts the least recently used table and
+// refuses to evict tables that played in the last two blocks.
+void additiveCacheClear() {
+    for (int s = 0; s < ADD_CACHE_SLOTS; s++) {
+        additiveCache[s].state = ADD_SLOT_EMPTY;
+        additiveCache[s].key = -1;
+    }
+    memset(additiveRequested, 0, sizeof(additiveRequested));
+}
+
+void additiveTime() {
+    static float table[ADD_TABLE_SIZE];
+    uint32_t cyclesPerMicro = SystemCoreClock / 1000000;
+
+    for (int octave = 0; octave < ADD_OCTAVES; octave++) {
+        uint32_t startTime = micros();
+        additiveBuild(table, 1, octave);
+        uint32_t cycles = (micros() - startTime) * cyclesPerMicro;
+
+        Serial.print("[Additive] Octave ");
+        Serial.print(octave);
+        Serial.print(" partials: ");
+        Serial.print(additivePartialLimit(octave));
+        Serial.print(" build cycles: ");
+        Serial.println(cycles);
+    }
+
+    // Fill every slot with timbre 0, octave 0 played longest ago
+    additiveCacheClear();
+    for (int octave = 0; octave < ADD_CACHE_SLOTS; octave++) {
+        additiveRequested[octave] = 1;
+        additiveServiceOne();
+    }
+    int hits = 0;
+    for (int octave = 0; octave < ADD_CACHE_SLOTS; octave++) {
+        additiveBlock++;
+        if (additiveFind(octave)) hits++;
+    }
+    Serial.print("[Additive] Hits: ");
+    Serial.print(hits);
+    Serial.println(hits == ADD_CACHE_SLOTS ? " PASS" : " FAIL");
+
+    // A new table replaces the oldest once it is out of the guard window
+    additiveBlock += 2;
+    int newKey = ADD_OCTAVES;
+    additiveRequested[newKey] = 1;
+    additiveServiceOne();
+    bool evicted = additiveFind(0) == nullptr && additiveFind(newKey) != nullptr;
+    for (int octave = 1; octave < ADD_CACHE_SLOTS; octave++) {
+        if (!additiveFind(octave)) evicted = false;
+    }
+    Serial.print("[Additive] LRU eviction:");
+    Serial.println(evicted ? " PASS" : " FAIL");
+
+    // Everything played this block: nothing may be evicted
+    additiveRequested[0] = 1;
+    bool refused = !additiveServiceOne() && additivePending();
+    Serial.print("[Additive] Busy cache refused:");
+    Serial.println(refused ? " PASS" : " FAIL");
+
+    additiveCacheClear();
+}
+
+// -------------------- Function: Measure Input Field Extraction --------------------
+// Decodes every field of the input word the way scanKeysTask did with
+// std::bitset and extractBits, then with the packed word, and prints both.
+// tools/inputbench.cpp runs the same loops on a host.
+template <size_t F, size_t C>
+std::bitset<C> bitsetExtractBits(const std::bitset<F>& inputBits, int startPos, int length) {
+    return std::bitset<C>((inputBits.to_ulong() >> startPos) & ((1 << length) - 1));
+}
+
+void inputExtractTime() {
+    const int iterations = 10000;
+    volatile uint32_t sink = 0;
+    uint32_t word = 0x0ABCDEF1;
+
+    uint32_t startTime = micros();
+    std::bitset<12> previousKeys("111111111111");
+    for (int n = 0; n < iterations; n++) {
+        word = word * 1664525 + 1013904223;
+        std::bitset<inputSize> inputs(word & INPUT_IDLE);
+        std::bitset<12> keys = bitsetExtractBits<inputSize, 12>(inputs, 0, 12);
+        std::bitset<8> knobs = bitsetExtractBits<inputSize, 8>(inputs, 12, 8);
+        std::bitset<4> clicks = bitsetExtractBits<inputSize, 4>(inputs, 20, 2).to_ulong() << 2 |
+                                bitsetExtractBits<inputSize, 4>(inputs, 24, 2).to_ulong();
+        std::bitset<1> joystick = bitsetExtractBits<inputSize, 1>(inputs, 22, 1);
+        std::bitset<1> west = bitsetExtractBits<inputSize, 1>(inputs, 23, 1);
+        std::bitset<1> east = bitsetExtractBits<inputSize, 1>(inputs, 27, 1);
+        uint32_t changedKeys = 0;
+        for (int i = 0; i < 12; i++) {
+            if (keys[i] != previousKeys[i]) changedKeys |= 1u << i;
+        }
+        for (int k = 0; k < 4; k++) {
+            sink += bitsetExtractBits<8, 2>(knobs, 2 * k, 2).to_ulong();
+        }
+        sink += changedKeys + clicks.to_ulong() + joystick[0] + west[0] + east[0];
+        previousKeys = keys;
+    }
+    uint32_t bitsetTime = micros() - startTime;
+
+    word = 0x0ABCDEF1;
+    startTime = micros();
+    uint32_t previousInputs = INPUT_IDLE;
+    for (int n = 0; n < iterations; n++) {
+        word = word * 1664525 + 1013904223;
+        uint32_t inputs = word & INPUT_IDLE;
+        uint32_t changedKeys = INPUT_KEYS(inputs ^ previousInputs);
+        for (int k = 0; k < 4; k++) {
+            sink += inputKnob(k)(inputs);
+        }
+        sink += changedKeys + inputClicks(inputs) + INPUT_JOYSTICK_PRESS(inputs) +
+                INPUT_WEST_DETECT(inputs) + INPUT_EAST_DETECT(inputs);
+        previousInputs = inputs;
+    }
+    uint32_t packedTime = micros() - startTime;
+
+    Serial.print("[Inputs] std::bitset ns/scan: ");
+    Serial.print(bitsetTime * 1000.0f / iterations);
+    Serial.print(" packed word ns/scan: ");
+    Serial.println(packedTime * 1000.0f / iterations);
+}
+
+// -------------------- Function: Replay Knob Quadrature Traces --------------------
+// Synthetic A/B traces, written by hand to model slow turns with contact
+// bounce, a flick, nudges and a lost sample. Each is a list of (state, ms)
+// runs, state = A | B << 1, replayed through the decoder one sample per ms
+// as the key scanner would.
+struct QuadratureRun {
+    uint8_t state;
+    uint16_t ms;
+};
+
+struct QuadratureTrace {
+    const char* name;
+    const QuadratureRun* runs;
+    int length;
+    int detents;                // Expected unaccelerated total
+    int steps;                  // Expected accelerated total
+};
+
+// Four slow detents clockwise, contacts bouncing on the way into each one
+const QuadratureRun traceSlow[] = {
+    {0, 200}, {1, 3}, {0, 1}, {1, 40}, {3, 2}, {1, 1}, {3, 80},
+    {2, 3}, {3, 1}, {2, 40}, {0, 2}, {2, 1}, {0, 80},
+    {1, 3}, {0, 1}, {1, 40}, {3, 2}, {1, 1}, {3, 80},
+    {2, 3}, {3, 1}, {2, 40}, {0, 2}, {2, 1}, {0, 80}
+};
+// Eight detents anticlockwise in under 50 ms
+const QuadratureRun traceFlick[] = {
+    {0, 200}, {2, 3}, {3, 3}, {1, 3}, {0, 3}, {2, 3}, {3, 3}, {1, 3}, {0, 3},
+    {2, 3}, {3, 3}, {1, 3}, {0, 3}, {2, 3}, {3, 3}, {1, 3}, {0, 200}
+};
+// Nudged either way without reaching the next detent
+const QuadratureRun traceNudge[] = {
+    {0, 200}, {1, 20}, {0, 20}, {2, 20}, {0, 20}, {1, 5}, {0, 5}, {0, 200}
+};
+// A sample lost in the middle of a detent, then one clean detent
+const QuadratureRun traceMissed[] = {
+    {0, 200}, {3, 60}, {2, 20}, {0, 100}
+};
+
+const QuadratureTrace quadratureTraces[] = {
+    {"slow", traceSlow, sizeof(traceSlow) / sizeof(traceSlow[0]), 4, 4},
+    {"flick", traceFlick, sizeof(traceFlick) / sizeof(traceFlick[0]), -8, -1 - 7 * 6},
+    {"nudge", traceNudge, sizeof(traceNudge) / sizeof(traceNudge[0]), 0, 0},
+    {"missed", traceMissed, sizeof(traceMissed) / sizeof(traceMissed[0]), 1, 1}
+};
+
+void quadratureTraceTest() {
+    for (const QuadratureTrace& trace : quadratureTraces) {
+        KnobDecoder knob;
+        uint32_t now = 0;
+        for (int r = 0; r < trace.length; r++) {
+            for (int ms = 0; ms < trace.runs[r].ms; ms++) {
+                quadratureSample(knob, trace.runs[r].state, ++now);
+            }
+        }
+
+        Serial.print("[Knob] ");
+        Serial.print(trace.name);
+        Serial.print(" detents: ");
+        Serial.print(knob.detents);
+        Serial.print(" steps: ");
+        Serial.print(knob.pending);
+        Serial.println((knob.detents == trace.detents && knob.pending == trace.steps) ? " PASS" : " FAIL");
+    }
+}
+
+// -------------------- Function: Note Event Bus Test --------------------
+// A tap inside one block must still sound for a block, a full ring must
+// drop and count, and posting should cost well under a microsecond
+void noteEventBusTest() {
+    noteEventsInit();
+    noteEventPost(NOTE_EVENT_ON, 40, 0);
+    noteEventPost(NOTE_EVENT_OFF, 40, 0);
+    noteEventsDrain();
+    bool held = notes.notes[40].active;
+    noteEventsDrain();
+    bool released = !notes.notes[40].active;
+    Serial.print("[NoteBus] short tap: ");
+    Serial.println((held && released) ? "PASS" : "FAIL");
+
+    uint32_t overflows = noteEventRing.overflows;
+    for (uint32_t i = 0; i < NOTE_EVENT_RING + 4; i++) noteEventPost(NOTE_EVENT_ON, i % 96, 0);
+    Serial.print("[NoteBus] overflow: ");
+    Serial.print(noteEventRing.overflows - overflows);
+    Serial.print(" high water: ");
+    Serial.print(noteEventRing.highWater);
+    Serial.println((noteEventRing.overflows - overflows == 4 && noteEventRing.highWater == NOTE_EVENT_RING) ? " PASS" : " FAIL");
+    noteEventsDrain();
+
+    const int iterations = 32;
+    uint32_t startTime = micros();
+    for (int i = 0; i < iterations; i++) noteEventPost((NoteEventType)(i & 1), 36 + (i >> 1), 0);
+    uint32_t postTime = micros() - startTime;
+    startTime = micros();
+    noteEventsDrain();
+    uint32_t drainTime = micros() - startTime;
+    Serial.print("[NoteBus] post: ");
+    Serial.print((float)postTime / iterations);
+    Serial.print(" us, drain of 32: ");
+    Serial.print(drainTime);
+    Serial.println(" us");
+    set_notes();
+}
+
+// -------------------- Function: Measure Deferred Log Cost --------------------
+// What a real-time task pays per logEvent, what Serial.print cost for the same
+// CAN TX line, and that a full ring drops and counts instead of blocking
+void logTime() {
+    const int iterations = 32;
+    logRing.init();
+    uint32_t startTime = micros();
+    for (int i = 0; i < iterations; i++) logEvent(LOG_CAN_TX, 'P', i, 4);
+    uint32_t logCost = micros() - startTime;
+
+    startTime = micros();
+    Serial.print("TX: ");
+    Serial.print('P');
+    Serial.print(1);
+    Serial.print(4);
+    Serial.println();
+    uint32_t printCost = micros() - startTime;
+
+    for (uint32_t i = 0; i < LOG_RING; i++) logEvent(LOG_CAN_TX, 'R', i, 4);
+    Serial.print("[Log] logEvent: ");
+    Serial.print((float)logCost / iterations);
+    Serial.print(" us, Serial.print line: ");
+    Serial.print(printCost);
+    Serial.print(" us, dropped on full ring: ");
+    Serial.print(logRing.overflows);
+    Serial.println(logRing.overflows == iterations ? " PASS" : " FAIL");
+    logRing.init();
+}
+
+// -------------------- Function: Profiler Accounting and Overhead --------------------
+// A probe nested in another must be charged only to itself, a probe that
+// closes while a later one is blocked must not be subtracted from it, and a
+// probe pair should cost a few dozen cycles
+void profilerTest() {
+    profileInit();
+    uint32_t cyclesPerUs = SystemCoreClock / 1000000;
+
+    profileBegin(PROF_BACKEND);
+    delayMicroseconds(500);
+    profileBegin(PROF_DECODE);
+    delayMicroseconds(200);
+    profileEnd(PROF_DECODE);
+    delayMicroseconds(300);
+    profileEnd(PROF_BACKEND);
+    uint32_t outerUs = profileRead(PROF_BACKEND).maxCycles / cyclesPerUs;
+    uint32_t innerUs = profileRead(PROF_DECODE).maxCycles / cyclesPerUs;
+
+    // Display opens, decode preempts and blocks, display closes, decode resumes
+    profileBegin(PROF_DISPLAY);
+    delayMicroseconds(300);
+    profileBegin(PROF_DECODE);
+    delayMicroseconds(100);
+    profileEnd(PROF_DISPLAY);
+    delayMicroseconds(100);
+    profileEnd(PROF_DECODE);
+    uint32_t blockedUs = profileRead(PROF_DECODE).maxCycles / cyclesPerUs;
+    bool pass = abs((int)outerUs - 800) < 20 && abs((int)innerUs - 200) < 20 && abs((int)blockedUs - 200) < 20;
+
+    const int iterations = 1000;
+    uint32_t start = DWT->CYCCNT;
+    for (int i = 0; i < iterations; i++) {
+        profileBegin(PROF_CAN_TX);
+        profileEnd(PROF_CAN_TX);
+    }
+    uint32_t pairCycles = (DWT->CYCCNT - start) / iterations;
+
+    Serial.print("[Profiler] outer (us): ");
+    Serial.print(outerUs);
+    Serial.print(", nested (us): ");
+    Serial.print(innerUs);
+    Serial.print(", blocked (us): ");
+    Serial.print(blockedUs);
+    Serial.print(", probe pair (cycles): ");
+    Serial.print(pairCycles);
+    Serial.println(pass ? " PASS" : " FAIL");
+    profileDump();
+}
+
 // -------------------- Function: Test Setup Entry Point --------------------
 void testSetup() {
     sysState.knobValues[2].current_knob_value = 4;
@@ -791,8 +1376,12 @@ void testSetup() {
 
     generatePhaseLUT();
     set_pin_directions();
+    joystickStart();
     set_notes();
+    noteEventsInit();
     init_settings();
+    settingsPublish();
+    uiPublish();
 
     CAN_Init(true);
     setCANFilter(0x123, 0x7ff);
@@ -807,6 +1396,23 @@ void testSetup() {
     backCalcTime();
     // canTXtime();
     // decodeTime();
+    // delayEchoTest();
+    // outputSNRTest();
+    // eqTime();
+    // fmTime();
+    // pluckTime();
+    // samplerTime();
+    // unisonTime();
+    // drumTime();
+    // additiveTime();
+    // inputExtractTime();
+    // quadratureTraceTest();
+    // noteEventBusTest();
+    // settingsSnapshotTest();
+    // uiSnapshotTest();
+    // menuScrollTest();
+    // logTime();
+    // profilerTest();
 
     while (1) {}  // Keep running
 }
@@ -819,9 +1425,13 @@ void setup() {
     // Initialize Phase Lookup Table and Settings
     generatePhaseLUT();
     set_pin_directions();
+    joystickStart();
     set_notes();
+    noteEventsInit();
     init_settings();
     initEffects();
+    settingsPublish();
+    uiPublish();
 
     // Initial Display Rendering
     initial_display();
@@ -861,10 +1471,12 @@ void setup() {
     */
 
     // Initialize Shared Resource Mutexes
-    notes.mutex = xSemaphoreCreateMutex();
     sysState.mutex = xSemaphoreCreateMutex();
     settings.mutex = xSemaphoreCreateMutex();
 
+    // Delay Line From the SRAM Left Over
+    initDelayBuffer();
+
     // Start RTOS Scheduler
     vTaskStartScheduler();
 }
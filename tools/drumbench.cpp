@@ -0,0 +1,53 @@
+// -------------------- Drum Kit Benchmark --------------------
+// Host tool: times the pad synthesis from src/drumkit.h with every pad
+// sounding (all five are restarted each half second), the worst case for the
+// audio task. drumTime() in test/test.h measures the same on the target.
+//
+//   g++ -std=c++17 -O2 -Isrc tools/drumbench.cpp -o drumbench && ./drumbench
+//
+// Reports the fastest of several passes in ns per output sample.
+#include <chrono>
+#include <cstdio>
+#include "drumkit.h"
+
+float sineTable[256];
+
+static const int SECONDS = 10;
+static const int PASSES = 5;
+static volatile float sink = 0.0f;
+
+static void startAllPads() {
+    // Open hat last, or the closed hat chokes it
+    for (int p = 0; p < DRUM_PADS; p++) drumStart(p == DRUM_OPEN_HAT ? DRUM_CLOSED_HAT : p);
+    drumStart(DRUM_OPEN_HAT);
+}
+
+static void renderKit() {
+    const int retrigger = SAMPLE_RATE / 2;
+    int sinceStart = retrigger;
+    for (int n = 0; n < SECONDS * SAMPLE_RATE; n += DRUM_BLOCK_SIZE) {
+        if (sinceStart >= retrigger) {
+            startAllPads();
+            sinceStart = 0;
+        }
+        drumRenderPads(DRUM_BLOCK_SIZE);
+        sink += drumState.out[0];
+        sinceStart += DRUM_BLOCK_SIZE;
+    }
+}
+
+int main() {
+    for (int i = 0; i < 256; i++) sineTable[i] = sinf(2.0f * (float)M_PI * i / 256);
+    drumsInit();
+
+    double best = 1e30;
+    for (int pass = 0; pass < PASSES; pass++) {
+        auto start = std::chrono::steady_clock::now();
+        renderKit();
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() < best) best = elapsed.count();
+    }
+    double perSample = best / ((double)SECONDS * SAMPLE_RATE);
+    printf("full kit ns/sample: %.1f\n", perSample);
+    return 0;
+}
@@ -0,0 +1,70 @@
+// -------------------- Master EQ Benchmark --------------------
+// Host tool: times the fixed-point biquads of src/eqbands.h, one band alone
+// and the whole eqBlock (DC split, Q20 conversion and 1..EQ_BANDS cascaded
+// bands), then checks the output peak with every band at +12 dB. eqTime() in
+// test/test.h measures the same on the target.
+//
+//   g++ -std=c++17 -O2 -Isrc tools/eqbench.cpp -o eqbench && ./eqbench
+//
+// Times are the fastest of several passes in ns per sample.
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "eqbands.h"
+
+static const int N = SAMPLE_RATE;               // One second
+static const int PASSES = 5;
+static float input[N];
+static float block[N];
+
+// Fastest pass of fn over the signal, in ns per sample
+template <typename Fn>
+static double timeBlocks(Fn fn) {
+    double best = 1e30;
+    for (int pass = 0; pass < PASSES; pass++) {
+        auto start = std::chrono::steady_clock::now();
+        for (int offset = 0; offset < N; offset += EQ_BLOCK_SIZE) fn(offset);
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() < best) best = elapsed.count();
+    }
+    return best / N;
+}
+
+static void setBands(int bands, float gainDb) {
+    eqActiveBands = 0;
+    for (int i = 0; i < bands; i++) {
+        designBiquad(eqBiquads[i], eqShapes[i], gainDb);
+        eqActive[eqActiveBands++] = i;
+    }
+    eqReset();
+}
+
+int main() {
+    // Unipolar like the mix: a 440 Hz tone on an offset, peak 160
+    for (int n = 0; n < N; n++) input[n] = 100.0f + 60.0f * sinf(2.0f * (float)M_PI * 440.0f * n / SAMPLE_RATE);
+
+    designBiquad(eqBiquads[0], eqShapes[0], 6.0f);
+    for (int n = 0; n < EQ_BLOCK_SIZE; n++) eqScratch[n] = (int32_t)(input[n] * (1u << EQ_SAMPLE_SHIFT));
+    printf("one band ns/sample: %.1f\n", timeBlocks([](int) { biquadBlock(eqBiquads[0], eqScratch, EQ_BLOCK_SIZE); }));
+
+    for (int bands = 1; bands <= EQ_BANDS; bands++) {
+        setBands(bands, 6.0f);
+        double ns = timeBlocks([](int offset) {
+            memcpy(&block[offset], &input[offset], EQ_BLOCK_SIZE * sizeof(float));
+            eqBlock(&block[offset], EQ_BLOCK_SIZE);
+        });
+        printf("eqBlock, %d band(s) ns/sample: %.1f\n", bands, ns);
+    }
+
+    setBands(EQ_BANDS, 4 * EQ_DB_PER_STEP);
+    memcpy(block, input, sizeof(block));
+    float peak = 0.0f;
+    for (int offset = 0; offset < N; offset += EQ_BLOCK_SIZE) {
+        eqBlock(&block[offset], EQ_BLOCK_SIZE);
+        if (offset >= N / 2) {
+            for (int n = 0; n < EQ_BLOCK_SIZE; n++) peak = std::max(peak, block[offset + n]);
+        }
+    }
+    printf("all bands +12 dB: input peak 160, output peak %.1f\n", peak);
+    return 0;
+}
@@ -0,0 +1,85 @@
+// -------------------- Input Extraction Benchmark --------------------
+// Host tool: times decoding every input field from a scan word, first with
+// the old std::bitset extraction and then with the packed-word fields from
+// src/inputfields.h. Same loops as inputExtractTime() in test/test.h, which
+// measures the target.
+//
+//   g++ -std=c++17 -Os -Isrc tools/inputbench.cpp -o inputbench && ./inputbench
+//
+// Each variant runs several times and the fastest pass is reported.
+#include <bitset>
+#include <chrono>
+#include <cstdio>
+#include "inputfields.h"
+
+static const int ITERATIONS = 1000000;
+static const int PASSES = 5;
+static volatile uint32_t sink = 0;
+
+// The extraction the firmware used before the packed word
+template <size_t F, size_t C>
+std::bitset<C> bitsetExtractBits(const std::bitset<F>& inputBits, int startPos, int length) {
+    return std::bitset<C>((inputBits.to_ulong() >> startPos) & ((1 << length) - 1));
+}
+
+static void bitsetScans() {
+    uint32_t word = 0x0ABCDEF1;
+    std::bitset<12> previousKeys("111111111111");
+    for (int n = 0; n < ITERATIONS; n++) {
+        word = word * 1664525 + 1013904223;
+        std::bitset<inputSize> inputs(word & INPUT_IDLE);
+        std::bitset<12> keys = bitsetExtractBits<inputSize, 12>(inputs, 0, 12);
+        std::bitset<8> knobs = bitsetExtractBits<inputSize, 8>(inputs, 12, 8);
+        std::bitset<4> clicks = bitsetExtractBits<inputSize, 4>(inputs, 20, 2).to_ulong() << 2 |
+                                bitsetExtractBits<inputSize, 4>(inputs, 24, 2).to_ulong();
+        std::bitset<1> joystick = bitsetExtractBits<inputSize, 1>(inputs, 22, 1);
+        std::bitset<1> west = bitsetExtractBits<inputSize, 1>(inputs, 23, 1);
+        std::bitset<1> east = bitsetExtractBits<inputSize, 1>(inputs, 27, 1);
+        uint32_t changedKeys = 0;
+        for (int i = 0; i < 12; i++) {
+            if (keys[i] != previousKeys[i]) changedKeys |= 1u << i;
+        }
+        for (int k = 0; k < 4; k++) {
+            sink += bitsetExtractBits<8, 2>(knobs, 2 * k, 2).to_ulong();
+        }
+        sink += changedKeys + clicks.to_ulong() + joystick[0] + west[0] + east[0];
+        previousKeys = keys;
+    }
+}
+
+static void packedScans() {
+    uint32_t word = 0x0ABCDEF1;
+    uint32_t previousInputs = INPUT_IDLE;
+    for (int n = 0; n < ITERATIONS; n++) {
+        word = word * 1664525 + 1013904223;
+        uint32_t inputs = word & INPUT_IDLE;
+        uint32_t changedKeys = INPUT_KEYS(inputs ^ previousInputs);
+        for (int k = 0; k < 4; k++) {
+            sink += inputKnob(k)(inputs);
+        }
+        sink += changedKeys + inputClicks(inputs) + INPUT_JOYSTICK_PRESS(inputs) +
+                INPUT_WEST_DETECT(inputs) + INPUT_EAST_DETECT(inputs);
+        previousInputs = inputs;
+    }
+}
+
+// Fastest pass, in ns per scan
+static double timeScans(void (*scans)()) {
+    double best = 1e30;
+    for (int pass = 0; pass < PASSES; pass++) {
+        auto start = std::chrono::steady_clock::now();
+        scans();
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() < best) best = elapsed.count();
+    }
+    return best / ITERATIONS;
+}
+
+int main() {
+    double bitsetNs = timeScans(bitsetScans);
+    double packedNs = timeScans(packedScans);
+    printf("std::bitset ns/scan: %.1f\n", bitsetNs);
+    printf("packed word ns/scan: %.1f\n", packedNs);
+    printf("speed-up: %.1fx\n", bitsetNs / packedNs);
+    return 0;
+}
@@ -0,0 +1,62 @@
+// -------------------- Binary Log Decoder --------------------
+// Host tool: reads the keyboard's serial stream and prints the log frames
+// from src/log.h as text, one line per record with its timestamp. Bytes
+// outside frames (start-up messages) are passed through unchanged.
+//
+//   g++ -std=c++17 -O2 -Isrc tools/logdecode.cpp -o logdecode
+//   stty -F /dev/ttyACM0 115200 raw && ./logdecode < /dev/ttyACM0
+//
+// A captured file works the same way: ./logdecode capture.bin
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include "logformat.h"
+
+static int32_t readLE32(const uint8_t* p) { return (int32_t)(p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24); }
+
+// Header fields that can't belong to a real frame mean the sync byte was data
+static bool validHeader(const uint8_t* header) {
+    return header[1] < LOG_FORMATS && header[2] <= LOG_MAX_ARGS;
+}
+
+static void printRecord(const uint8_t* frame) {
+    int32_t args[LOG_MAX_ARGS] = {0};
+    for (int i = 0; i < frame[2]; i++) args[i] = readLE32(&frame[LOG_HEADER_BYTES + 4 * i]);
+    uint32_t time = (uint32_t)readLE32(&frame[3]);
+    printf("[%10.6f] ", time / 1e6);
+    printf(logFormats[frame[1]], args[0], args[1], args[2]);
+    printf("\n");
+}
+
+int main(int argc, char** argv) {
+    FILE* in = (argc > 1) ? fopen(argv[1], "rb") : stdin;
+    if (!in) {
+        fprintf(stderr, "%s: cannot open\n", argv[1]);
+        return 1;
+    }
+
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+    uint8_t frame[LOG_FRAME_BYTES];
+    int length = 0;
+    int c;
+    while ((c = fgetc(in)) != EOF) {
+        if (length == 0) {
+            if (c == LOG_FRAME_SYNC) frame[length++] = c;
+            else putchar(c);
+            continue;
+        }
+        frame[length++] = c;
+        if (length < LOG_HEADER_BYTES) continue;
+        if (length == LOG_HEADER_BYTES && !validHeader(frame)) {
+            // Not a frame: emit the bytes and look for the next sync
+            fwrite(frame, 1, length, stdout);
+            length = 0;
+            continue;
+        }
+        if (length == LOG_HEADER_BYTES + 4 * frame[2]) {
+            printRecord(frame);
+            length = 0;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+// -------------------- Output Requantizer Benchmark --------------------
+// Host tool: runs a quiet 1 kHz sine (3 LSB at 8-bit) through the requantizer
+// in src/output.h at each noise shaping order and reports the SNR, the
+// in-band SNR (error weighted by a 4 kHz one-pole lowpass) and the cost.
+// outputSNRTest() in test/test.h measures the same on the target.
+//
+//   g++ -std=c++17 -O2 -Isrc tools/outputbench.cpp -o outputbench && ./outputbench
+//
+// Add -DOUTPUT_BITS=12 for the DAC build. Times are the fastest of several
+// passes in ns per sample.
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include "output.h"
+
+static const int SAMPLE_RATE = 22000;
+static const int N = SAMPLE_RATE;               // One second
+static const int PASSES = 5;
+static float input[N];
+static sample_t output[N];
+
+int main() {
+    const float amplitude = 3.0f;
+    for (int n = 0; n < N; n++) {
+        input[n] = 128.0f + amplitude * sinf(2.0f * (float)M_PI * 1000.0f * n / SAMPLE_RATE);
+    }
+    const float dt = 1.0f / SAMPLE_RATE;
+    const float rc = 1.0f / (2.0f * (float)M_PI * 4000.0f);
+    const float alpha = dt / (rc + dt);
+    const float signalPower = amplitude * amplitude / 2;
+
+    printf("OUTPUT_BITS %d\n", OUTPUT_BITS);
+    for (int order = 0; order <= 2; order++) {
+        outputShaper.order = order;
+
+        double best = 1e30;
+        for (int pass = 0; pass < PASSES; pass++) {
+            resetOutputShaper();
+            auto start = std::chrono::steady_clock::now();
+            for (int n = 0; n < N; n++) output[n] = requantize(input[n]);
+            std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() < best) best = elapsed.count();
+        }
+
+        double noisePower = 0.0, inbandPower = 0.0;
+        float lp = 0.0f;
+        for (int n = 0; n < N; n++) {
+            float e = output[n] / OUTPUT_SCALE - input[n];
+            lp += alpha * (e - lp);
+            noisePower += e * e;
+            inbandPower += lp * lp;
+        }
+        printf("order %d SNR %.1f dB, in-band SNR %.1f dB, %.1f ns/sample\n", order,
+               10 * log10(signalPower / (noisePower / N)), 10 * log10(signalPower / (inbandPower / N)), best / N);
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+// -------------------- Placeholder Piano Zones --------------------
+// Host tool: synthesises the two piano zones shipped in src/samples/ and
+// writes them as ADPCM headers, the same image format tools/wav2adpcm.cpp
+// produces from a WAV. No recording is involved: each zone is up to eleven
+// harmonics, harmonic k decaying from its peak to 1/2k of it, with the
+// envelope frozen from the loop start so the loop is steady. Replace them
+// with real recordings through wav2adpcm.
+//
+//   g++ -std=c++17 -O2 -Isrc tools/pianogen.cpp -o pianogen
+//   ./pianogen PianoA3 220 0.5 8800 10800 > src/samples/piano_a3.h
+//   ./pianogen PianoA6 1760 0.3 5000 6500 > src/samples/piano_a6.h
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "adpcm.h"
+
+static const uint32_t SAMPLE_RATE = 22000;
+static const int HARMONICS = 11;
+
+static std::vector<int16_t> synthesise(double rootHz, double seconds, uint32_t loopStart) {
+    std::vector<int16_t> samples((size_t)(SAMPLE_RATE * seconds));
+    for (size_t i = 0; i < samples.size(); i++) {
+        double t = (double)i / SAMPLE_RATE;
+        double envTime = (i < loopStart) ? t : (double)loopStart / SAMPLE_RATE;
+        double v = 0.0;
+        for (int k = 1; k <= HARMONICS && k * rootHz <= SAMPLE_RATE / 2; k++) {
+            double peak = 1.0 / pow(k, 1.5);
+            double sustain = peak * 0.5 / k;
+            double tau = 0.05 / sqrt(k);
+            double env = sustain + (peak - sustain) * exp(-envTime / tau);
+            v += env * sin(2.0 * M_PI * k * rootHz * t + 0.3 * k);
+        }
+        double attack = std::min(1.0, t / 0.002);
+        double s = std::max(-32767.0, std::min(32767.0, v * attack * 14000.0));
+        samples[i] = (int16_t)s;
+    }
+    return samples;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 6) {
+        fprintf(stderr, "usage: %s Name rootHz seconds loopStart loopEnd > src/samples/name.h\n", argv[0]);
+        return 1;
+    }
+    std::string name = argv[1];
+    double rootFrequency = strtod(argv[2], nullptr);
+    double seconds = strtod(argv[3], nullptr);
+    uint32_t loopStart = strtoul(argv[4], nullptr, 10);
+    uint32_t loopEnd = strtoul(argv[5], nullptr, 10);
+
+    std::vector<int16_t> samples = synthesise(rootFrequency, seconds, loopStart);
+    uint32_t length = samples.size();
+    if (loopEnd > length || loopStart >= loopEnd) loopStart = loopEnd = 0;
+
+    AdpcmDecoder dec = {0, 0, 0};
+    AdpcmDecoder loopState = dec;
+    std::vector<uint8_t> image((length + 1) / 2, 0);
+    for (uint32_t i = 0; i < length; i++) {
+        if (i == loopStart) loopState = dec;
+        uint8_t nibble = adpcmEncodeSample(dec, samples[i]);
+        image[i >> 1] |= (i & 1) ? nibble << 4 : nibble;
+    }
+
+    printf("// Synthesised placeholder, not a recording: generated by tools/pianogen.cpp\n");
+    printf("//   ./pianogen %s %s %s %u %u\n", argv[1], argv[2], argv[3], loopStart, loopEnd);
+    printf("// %u samples at %u Hz, root %.2f Hz, loop %u..%u, %zu bytes\n",
+           length, SAMPLE_RATE, rootFrequency, loopStart, loopEnd, image.size());
+    printf("const uint8_t sample%sData[%zu] = {", name.c_str(), image.size());
+    for (size_t i = 0; i < image.size(); i++) {
+        printf("%s0x%02X%s", (i % 16) ? "" : "\n    ", image[i], (i + 1 < image.size()) ? "," : "");
+    }
+    printf("\n};\n\n");
+    printf("const AdpcmSample sample%s = {sample%sData, %u, %u, %.2ff, %u, %u, %d, %d};\n",
+           name.c_str(), name.c_str(), length, SAMPLE_RATE, rootFrequency,
+           loopStart, loopEnd, loopState.predictor, loopState.index);
+    return 0;
+}
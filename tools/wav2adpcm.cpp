@@ -0,0 +1,118 @@
+// -------------------- WAV to IMA-ADPCM Flash Image --------------------
+// Host tool: converts a 16-bit PCM WAV into a C header holding a 4:1 ADPCM
+// image for src/sampler.h. Stereo input is mixed to mono. Loop points come
+// from the WAV "smpl" chunk unless given on the command line.
+//
+//   g++ -std=c++17 -O2 -Isrc tools/wav2adpcm.cpp -o wav2adpcm
+//   ./wav2adpcm piano.wav PianoC4 261.63 [loopStart loopEnd] > src/samples/piano_c4.h
+//
+// then list &samplePianoC4 in samplerZones.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "adpcm.h"
+
+struct WavData {
+    std::vector<int16_t> samples;
+    uint32_t sampleRate = 0;
+    uint32_t loopStart = 0;
+    uint32_t loopEnd = 0;
+};
+
+static uint32_t readLE32(const uint8_t* p) { return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24; }
+static uint16_t readLE16(const uint8_t* p) { return p[0] | p[1] << 8; }
+
+static bool readWav(const char* path, WavData& wav) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    std::vector<uint8_t> bytes;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) bytes.insert(bytes.end(), buf, buf + n);
+    fclose(f);
+
+    if (bytes.size() < 12 || memcmp(&bytes[0], "RIFF", 4) || memcmp(&bytes[8], "WAVE", 4)) {
+        fprintf(stderr, "%s: not a RIFF/WAVE file\n", path);
+        return false;
+    }
+
+    uint16_t channels = 0, bits = 0, format = 0;
+    const uint8_t* pcm = nullptr;
+    uint32_t pcmBytes = 0;
+    for (size_t pos = 12; pos + 8 <= bytes.size();) {
+        const uint8_t* chunk = &bytes[pos];
+        uint32_t size = readLE32(chunk + 4);
+        if (pos + 8 + size > bytes.size()) size = bytes.size() - pos - 8;
+        if (!memcmp(chunk, "fmt ", 4) && size >= 16) {
+            format = readLE16(chunk + 8);
+            channels = readLE16(chunk + 10);
+            wav.sampleRate = readLE32(chunk + 12);
+            bits = readLE16(chunk + 22);
+        } else if (!memcmp(chunk, "data", 4)) {
+            pcm = chunk + 8;
+            pcmBytes = size;
+        } else if (!memcmp(chunk, "smpl", 4) && size >= 60 && readLE32(chunk + 8 + 28) > 0) {
+            // First loop; the end in the chunk is inclusive
+            wav.loopStart = readLE32(chunk + 8 + 36 + 8);
+            wav.loopEnd = readLE32(chunk + 8 + 36 + 12) + 1;
+        }
+        pos += 8 + size + (size & 1);
+    }
+
+    if (format != 1 || bits != 16 || channels < 1 || !pcm) {
+        fprintf(stderr, "%s: need 16-bit PCM\n", path);
+        return false;
+    }
+    uint32_t frames = pcmBytes / (2 * channels);
+    wav.samples.resize(frames);
+    for (uint32_t i = 0; i < frames; i++) {
+        int32_t sum = 0;
+        for (int c = 0; c < channels; c++) sum += (int16_t)readLE16(pcm + 2 * (i * channels + c));
+        wav.samples[i] = (int16_t)(sum / channels);
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 4 && argc != 6) {
+        fprintf(stderr, "usage: %s in.wav Name rootHz [loopStart loopEnd] > src/samples/name.h\n", argv[0]);
+        return 1;
+    }
+
+    WavData wav;
+    if (!readWav(argv[1], wav)) return 1;
+    std::string name = argv[2];
+    float rootFrequency = strtof(argv[3], nullptr);
+    if (argc == 6) {
+        wav.loopStart = strtoul(argv[4], nullptr, 10);
+        wav.loopEnd = strtoul(argv[5], nullptr, 10);
+    }
+    uint32_t length = wav.samples.size();
+    if (wav.loopEnd > length || wav.loopStart >= wav.loopEnd) wav.loopStart = wav.loopEnd = 0;
+
+    // Encode against the firmware decoder, noting its state where the loop restarts
+    AdpcmDecoder dec = {0, 0, 0};
+    AdpcmDecoder loopState = dec;
+    std::vector<uint8_t> image((length + 1) / 2, 0);
+    for (uint32_t i = 0; i < length; i++) {
+        if (i == wav.loopStart) loopState = dec;
+        uint8_t nibble = adpcmEncodeSample(dec, wav.samples[i]);
+        image[i >> 1] |= (i & 1) ? nibble << 4 : nibble;
+    }
+
+    const char* source = strrchr(argv[1], '/') ? strrchr(argv[1], '/') + 1 : argv[1];
+    printf("// Generated by tools/wav2adpcm.cpp from %s\n", source);
+    printf("// %u samples at %u Hz, root %.2f Hz, loop %u..%u, %zu bytes\n",
+           length, wav.sampleRate, rootFrequency, wav.loopStart, wav.loopEnd, image.size());
+    printf("const uint8_t sample%sData[%zu] = {", name.c_str(), image.size());
+    for (size_t i = 0; i < image.size(); i++) {
+        printf("%s0x%02X%s", (i % 16) ? "" : "\n    ", image[i], (i + 1 < image.size()) ? "," : "");
+    }
+    printf("\n};\n\n");
+    printf("const AdpcmSample sample%s = {sample%sData, %u, %u, %.2ff, %u, %u, %d, %d};\n",
+           name.c_str(), name.c_str(), length, wav.sampleRate, rootFrequency,
+           wav.loopStart, wav.loopEnd, loopState.predictor, loopState.index);
+    return 0;
+}